@@ -1,80 +1,68 @@
 const uclass = require('uclass')().bind(this, global);
 
-/** 
+/**
 Wrapper class to enable some passthrough ges binding.
-ATM only supports string params and a maximum of 10 bind events
-before it overwrites older binds. This is due to the limitation that
-UFUNCTIONS have to be defined at design time. Todo: add support for ~100?
+Backed by the native GESJsReceiverActor: every bind gets an id and all
+events arrive through a single dispatch function, so there is no limit
+on the number of binds. Call setBatched(true) to receive all events of
+a frame in one call instead of one call per event.
 
 Super experimental atm
 */
-class GESJsReceiver extends JsOwner.ClassMap['GESJsReceiverBpActor']{
+class GESJsReceiver extends JsOwner.ClassMap['GESJsReceiverActor']{
 	ctor(){
 		this.callbacks = {};
 	}
 	constructor(){
 	}
 
-	OnJsReceive(uniqueId, property){
-		this.callbacks[uniqueId](property);
+	_deliver(bindId, stringValue, objectValue){
+		const entry = this.callbacks[bindId];
+		if(entry){
+			entry.callback(entry.wantsObject ? objectValue : stringValue);
+		}
 	}
 
-	OnJsReceiveObj(uniqueId, property){
-		this.callbacks[uniqueId](property);
+	OnJsDispatch(bindId, stringValue, objectValue){
+		this._deliver(bindId, stringValue, objectValue);
 	}
 
-	//returns a unique id for potential unbinding
-	bind(domain='global.default', event, callback){
-		//const uniqueKey = domain + '.' + event;
-		const uniqueFunctionId = this.NextUniqueReceiver()['NextUniqueFunction'];
-
-		if(uniqueFunctionId == 'OnJsReceiveOneParam_9'){
-			console.warn('GESJsReceiver: Maximum receivers reached!');
+	OnJsDispatchBatch(events){
+		for(const e of events){
+			this._deliver(e.BindId, e.StringValue, e.ObjectValue);
 		}
-
-		this.callbacks[uniqueFunctionId] = callback;
-
-		this.JsGESBindEvent(domain,
-			event,
-			uniqueFunctionId);
-		return uniqueFunctionId;
 	}
 
-	bindToObjCallback(domain='global.default', event, callback, uniqueReceiver = false){
-		//const uniqueKey = domain + '.' + event;
-		const uniqueFunctionId = this.NextUniqueReceiverObj()['NextUniqueFunction'];
-
-		if(uniqueReceiver && uniqueFunctionId == 'OnJsReceiveOneParamObj_1'){
-			console.warn('GESJsReceiver: Maximum obj receivers (1) reached (uniqueReceiver: true)!');
-			return '';
-		}
-		
-		if(uniqueFunctionId == 'OnJsReceiveOneParamObj_4'){
-			console.warn('GESJsReceiver: Maximum obj receivers reached!');
-		}
-
-		this.callbacks[uniqueFunctionId] = callback;
+	setBatched(batched=true){
+		this.bBatchEvents = batched;
+	}
 
-		console.log(`UniqueId is <${uniqueFunctionId}>`)
+	//returns a unique id for unbinding
+	bind(domain='global.default', event, callback){
+		const bindId = this.JsBind(domain, event);
+		this.callbacks[bindId] = {callback, wantsObject: false};
+		return bindId;
+	}
 
-		this.JsGESBindEvent(domain,
-			event,
-			uniqueFunctionId);
-		return uniqueFunctionId;
+	bindToObjCallback(domain='global.default', event, callback){
+		const bindId = this.JsBind(domain, event);
+		this.callbacks[bindId] = {callback, wantsObject: true};
+		return bindId;
 	}
 
 	emit(domain='global.default', event, data='', pinned=false){
 		if(typeof data === 'string'){
-			this.JsGESEmitEventOneParamString(domain, event, data, pinned);
+			this.JsEmitString(domain, event, data, pinned);
 		}
 		else{
-			this.JsGESEmitEventOneParamObject(domain, event, data, pinned);
+			this.JsEmitObject(domain, event, data, pinned);
 		}
 	}
 
-	//NB: need to store the unique function id you get from bind
-	unbind(domain='global.default', event, uniqueFunctionId){
-		this.UnbindEvent(domain, event, uniqueFunctionId);
+	//NB: need to store the bind id you get from bind. Domain and event are kept for compatibility.
+	unbind(domain='global.default', event, bindId){
+		delete this.callbacks[bindId];
+		this.JsUnbind(bindId);
 	}
 
 	wlog(text){
@@ -84,11 +72,11 @@ class GESJsReceiver extends JsOwner.ClassMap['GESJsReceiverBpActor']{
 		this.emit('global.console', 'log', text);
 	}
 	unbindAll(){
-		this.UnbindAllEvents();
-		//GlobalEventSystemBPLibrary.GESUnbindAllEventsForContext(this);
+		this.callbacks = {};
+		this.JsUnbindAll();
 	}
 }
 
 const GESJsReceiver_C = uclass(GESJsReceiver);
 
-exports.ges = new GESJsReceiver_C(GWorld, {Z:0});
\ No newline at end of file
+exports.ges = new GESJsReceiver_C(GWorld, {Z:0});
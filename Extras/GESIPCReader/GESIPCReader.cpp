@@ -0,0 +1,266 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+/**
+* Standalone reader for the GES shared memory bridge (FGESIPCBridge). Prints mirrored events and
+* can inject events back into the game. No engine dependency, can stand in for a game or a tool
+* in local tests.
+*
+* Build:	g++ -std=c++17 -O2 GESIPCReader.cpp -o ges_ipc_reader -lrt
+*
+* Usage:	ges_ipc_reader [--segment /ges_bridge] [--create capacity] [--once]
+*			ges_ipc_reader [--segment /ges_bridge] --emit domain event [string]
+*
+*	--create	create and initialize the segment if the game hasn't yet
+*	--once		drain what is currently in the ring and exit instead of following it
+*	--emit		write one event into the inbound ring (string payload or no payload)
+*/
+
+#include "../../Source/GlobalEventSystem/Private/GESWireFormat.h"
+#include "../../Source/GlobalEventSystem/Private/GESIPCRing.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using GESWire::EPayloadType;
+
+namespace
+{
+	std::string ReadString(GESWire::FReader& Reader)
+	{
+		const uint8_t* Bytes = nullptr;
+		uint32_t Num = 0;
+		if (!Reader.ReadSized(Bytes, Num))
+		{
+			return std::string();
+		}
+		return std::string((const char*)Bytes, Num);
+	}
+
+	void AppendString(std::vector<uint8_t>& Out, const std::string& String)
+	{
+		uint32_t Num = (uint32_t)String.size();
+		Out.insert(Out.end(), (const uint8_t*)&Num, (const uint8_t*)&Num + sizeof(Num));
+		Out.insert(Out.end(), String.begin(), String.end());
+	}
+
+	std::string PayloadToString(GESWire::FReader& Reader, bool bAllowTyped = true)
+	{
+		uint8_t Type = 0;
+		if (!Reader.Read(Type))
+		{
+			return "<malformed>";
+		}
+		switch ((EPayloadType)Type)
+		{
+		case EPayloadType::None:
+			return "<none>";
+		case EPayloadType::Bool:
+		{
+			uint8_t Value = 0;
+			Reader.Read(Value);
+			return Value ? "true" : "false";
+		}
+		case EPayloadType::Byte:
+		{
+			uint8_t Value = 0;
+			Reader.Read(Value);
+			return std::to_string(Value);
+		}
+		case EPayloadType::Int32:
+		{
+			int32_t Value = 0;
+			Reader.Read(Value);
+			return std::to_string(Value);
+		}
+		case EPayloadType::Int64:
+		{
+			int64_t Value = 0;
+			Reader.Read(Value);
+			return std::to_string(Value);
+		}
+		case EPayloadType::Float:
+		{
+			float Value = 0.f;
+			Reader.Read(Value);
+			return std::to_string(Value);
+		}
+		case EPayloadType::Double:
+		{
+			double Value = 0.0;
+			Reader.Read(Value);
+			return std::to_string(Value);
+		}
+		case EPayloadType::String:
+			return "\"" + ReadString(Reader) + "\"";
+		case EPayloadType::Name:
+			return "name:" + ReadString(Reader);
+		case EPayloadType::Object:
+			return "object:" + ReadString(Reader);
+		case EPayloadType::Struct:
+		case EPayloadType::Property:
+		{
+			std::string TypeName = ReadString(Reader);
+			const uint8_t* Bytes = nullptr;
+			uint32_t Num = 0;
+			Reader.ReadSized(Bytes, Num);
+			return TypeName + " (" + std::to_string(Num) + " bytes)";
+		}
+		case EPayloadType::Typed:
+		{
+			if (!bAllowTyped)
+			{
+				return "<malformed>";
+			}
+			std::string Descriptor = ReadString(Reader);
+			return Descriptor + " " + PayloadToString(Reader, false);
+		}
+		default:
+			return "<unknown type " + std::to_string(Type) + ">";
+		}
+	}
+
+	void PrintMessage(const uint8_t* Data, uint32_t Num)
+	{
+		GESWire::FReader Reader(Data, Num);
+		std::string Domain = ReadString(Reader);
+		std::string Event = ReadString(Reader);
+		uint8_t Pinned = 0;
+		Reader.Read(Pinned);
+		std::string Payload = PayloadToString(Reader);
+
+		printf("%s.%s%s %s\n", Domain.c_str(), Event.c_str(), Pinned ? " [pinned]" : "", Reader.bError ? "<malformed>" : Payload.c_str());
+		fflush(stdout);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string SegmentName = "/ges_bridge";
+	uint32_t CreateCapacity = 0;
+	bool bOnce = false;
+	std::vector<std::string> EmitArgs;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string Arg = argv[i];
+		if (Arg == "--segment" && i + 1 < argc)
+		{
+			SegmentName = argv[++i];
+		}
+		else if (Arg == "--create" && i + 1 < argc)
+		{
+			CreateCapacity = GESIPC::AlignRecord((uint32_t)strtoul(argv[++i], nullptr, 10));
+		}
+		else if (Arg == "--once")
+		{
+			bOnce = true;
+		}
+		else if (Arg == "--emit")
+		{
+			for (i = i + 1; i < argc; i++)
+			{
+				EmitArgs.push_back(argv[i]);
+			}
+		}
+		else
+		{
+			fprintf(stderr, "unknown argument %s\n", Arg.c_str());
+			return 2;
+		}
+	}
+
+	int Fd = shm_open(SegmentName.c_str(), O_RDWR | (CreateCapacity ? O_CREAT : 0), 0660);
+	if (Fd < 0)
+	{
+		fprintf(stderr, "could not open %s, is the bridge running? (or pass --create)\n", SegmentName.c_str());
+		return 1;
+	}
+
+	if (CreateCapacity && ftruncate(Fd, (off_t)GESIPC::SegmentSize(CreateCapacity)) != 0)
+	{
+		fprintf(stderr, "could not size %s\n", SegmentName.c_str());
+		return 1;
+	}
+
+	struct stat Stat;
+	fstat(Fd, &Stat);
+	void* Base = mmap(nullptr, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+	if (Base == MAP_FAILED)
+	{
+		fprintf(stderr, "could not map %s\n", SegmentName.c_str());
+		return 1;
+	}
+	if (CreateCapacity)
+	{
+		GESIPC::InitializeSegment(Base, CreateCapacity);
+	}
+
+	GESIPC::FRing Outbound = GESIPC::GetRing(Base, 0);
+	GESIPC::FRing Inbound = GESIPC::GetRing(Base, 1);
+	if (!Outbound.IsValid() || !Inbound.IsValid())
+	{
+		fprintf(stderr, "%s is not an initialized GES segment\n", SegmentName.c_str());
+		return 1;
+	}
+
+	if (!EmitArgs.empty())
+	{
+		if (EmitArgs.size() < 2)
+		{
+			fprintf(stderr, "--emit needs a domain and an event\n");
+			return 2;
+		}
+		std::vector<uint8_t> Message;
+		AppendString(Message, EmitArgs[0]);
+		AppendString(Message, EmitArgs[1]);
+		Message.push_back(0);	//not pinned
+		if (EmitArgs.size() > 2)
+		{
+			Message.push_back((uint8_t)EPayloadType::String);
+			AppendString(Message, EmitArgs[2]);
+		}
+		else
+		{
+			Message.push_back((uint8_t)EPayloadType::None);
+		}
+		if (!Inbound.TryWrite(Message.data(), (uint32_t)Message.size()))
+		{
+			fprintf(stderr, "inbound ring full\n");
+			return 1;
+		}
+		return 0;
+	}
+
+	while (true)
+	{
+		bool bDidRead = Outbound.TryRead([](const uint8_t* Data, uint32_t Num)
+		{
+			PrintMessage(Data, Num);
+		});
+
+		if (!bDidRead)
+		{
+			if (bOnce)
+			{
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	if (Outbound.GetDroppedRecords() > 0)
+	{
+		fprintf(stderr, "%llu records dropped by the writer\n", (unsigned long long)Outbound.GetDroppedRecords());
+	}
+	munmap(Base, (size_t)Stat.st_size);
+	close(Fd);
+	return 0;
+}
@@ -1,5 +1,8 @@
 #include "GESBaseReceiverComponent.h"
 #include "GlobalEventSystemBPLibrary.h"
+#include "GESHandler.h"
+#include "GameFramework/Actor.h"
+#include "TimerManager.h"
 
 UGESBaseReceiverComponent::UGESBaseReceiverComponent(const FObjectInitializer& init) : UActorComponent(init)
 {
@@ -7,6 +10,8 @@ UGESBaseReceiverComponent::UGESBaseReceiverComponent(const FObjectInitializer& i
 	bUnbindOnEndPlay = true;
 	bPinInternalDataForPolling = true;
 	bDidReceiveEventAtLeastOnce = false;
+	bInternalListenerBound = false;
+	bRegisteredPollReader = false;
 
 	BindSettings.ReceivingFunction = TEXT("OnEvent(component)");
 }
@@ -19,12 +24,26 @@ void UGESBaseReceiverComponent::BeginPlay()
 		//special case
 		if (BindSettings.ReceivingFunction == TEXT("OnEvent(component)"))
 		{
-			InternalListener.BindDynamic(this, &UGESBaseReceiverComponent::HandleInternalEvent);
-			UGlobalEventSystemBPLibrary::GESBindEventToDelegate(this, InternalListener, BindSettings.Domain, BindSettings.Event);
+			if (bPinInternalDataForPolling)
+			{
+				FGESHandler::ForDomain(BindSettings.Domain, this)->AddPollReader(BindSettings.Domain, BindSettings.Event);
+				bRegisteredPollReader = true;
+			}
+
+			//pure pollers read the handler's slot, the listener is only needed to feed OnEvent
+			if (!bRegisteredPollReader || OnEvent.IsBound())
+			{
+				BindOnEventListener();
+			}
+			else if (UWorld* World = GetWorld())
+			{
+				//OnEvent is usually bound in the owner's BeginPlay which runs after ours
+				World->GetTimerManager().SetTimerForNextTick(this, &UGESBaseReceiverComponent::BindIfOnEventBound);
+			}
 		}
 		else
 		{
-			UGlobalEventSystemBPLibrary::GESBindEvent(this, BindSettings.Domain, BindSettings.Event, BindSettings.ReceivingFunction);
+			UGlobalEventSystemBPLibrary::GESBindEvent(this, BindSettings.Domain, BindSettings.Event, BindSettings.ReceivingFunction, BindSettings.DeliveryPhase, PositionSource());
 		}
 	}
 }
@@ -35,8 +54,21 @@ void UGESBaseReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
 	{
 		if (BindSettings.ReceivingFunction == TEXT("OnEvent(component)"))
 		{
-			UGlobalEventSystemBPLibrary::GESUnbindDelegate(this, InternalListener, BindSettings.Domain, BindSettings.Event);
-			PinnedData.CleanupPinnedData();
+			if (bInternalListenerBound)
+			{
+				UGlobalEventSystemBPLibrary::GESUnbindDelegate(this, InternalListener, BindSettings.Domain, BindSettings.Event);
+				bInternalListenerBound = false;
+			}
+			if (bRegisteredPollReader)
+			{
+				TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(BindSettings.Domain, this);
+				if (Handler.IsValid())
+				{
+					Handler->RemovePollReader(BindSettings.Domain, BindSettings.Event);
+				}
+				bRegisteredPollReader = false;
+			}
+			LastReceivedProperty = FGESWildcardProperty();
 		}
 		else
 		{
@@ -46,23 +78,69 @@ void UGESBaseReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
 	Super::EndPlay(EndPlayReason);
 }
 
-void UGESBaseReceiverComponent::HandleInternalEvent(const FGESWildcardProperty& WildcardProperty)
+void UGESBaseReceiverComponent::BindOnEventListener()
+{
+	if (bInternalListenerBound)
+	{
+		return;
+	}
+	InternalListener.BindDynamic(this, &UGESBaseReceiverComponent::HandleInternalEvent);
+	UGlobalEventSystemBPLibrary::GESBindEventToDelegate(this, InternalListener, BindSettings.Domain, BindSettings.Event, BindSettings.DeliveryPhase, PositionSource());
+	bInternalListenerBound = true;
+}
+
+void UGESBaseReceiverComponent::BindIfOnEventBound()
 {
-	LastReceivedProperty = WildcardProperty;
+	if (HasBegunPlay() && OnEvent.IsBound())
+	{
+		BindOnEventListener();
+	}
+}
 
-	if (bPinInternalDataForPolling)
+USceneComponent* UGESBaseReceiverComponent::PositionSource() const
+{
+	return (BindSettings.bListenAtOwnerLocation && GetOwner()) ? GetOwner()->GetRootComponent() : nullptr;
+}
+
+bool UGESBaseReceiverComponent::GetLastReceivedProperty(FGESWildcardProperty& OutProperty)
+{
+	OutProperty = ResolveLastReceivedProperty();
+	if (bRegisteredPollReader && OutProperty.PropertyPtr)
 	{
-		PinnedData.Property = WildcardProperty.Property.Get();
-		PinnedData.PropertyPtr = WildcardProperty.PropertyPtr;
+		bDidReceiveEventAtLeastOnce = true;
+	}
+	return bDidReceiveEventAtLeastOnce;
+}
 
-		//We need to use pinning to catch non-pinned data emitted
-		PinnedData.CopyPropertyToPinnedBuffer();
+FGESWildcardProperty UGESBaseReceiverComponent::ResolveLastReceivedProperty() const
+{
+	if (!bRegisteredPollReader)
+	{
+		return LastReceivedProperty;
+	}
 
-		LastReceivedProperty.Property = PinnedData.Property;
-		LastReceivedProperty.PropertyPtr = PinnedData.PropertyPtr;
+	//points into the handler's poll slot, only valid until the next emit of this event
+	FGESWildcardProperty Polled;
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(BindSettings.Domain, const_cast<UGESBaseReceiverComponent*>(this));
+	if (Handler.IsValid())
+	{
+		Handler->GetPolledValue(BindSettings.Domain, BindSettings.Event, Polled);
 	}
+	return Polled;
+}
 
+void UGESBaseReceiverComponent::HandleInternalEvent(const FGESWildcardProperty& WildcardProperty)
+{
 	bDidReceiveEventAtLeastOnce = true;
 
-	OnEvent.Broadcast(WildcardProperty);
+	//polled values are resolved on read, nothing to copy
+	if (!bRegisteredPollReader)
+	{
+		LastReceivedProperty = WildcardProperty;
+	}
+
+	if (OnEvent.IsBound())
+	{
+		OnEvent.Broadcast(WildcardProperty);
+	}
 }
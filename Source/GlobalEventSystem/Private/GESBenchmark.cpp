@@ -0,0 +1,87 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESBenchmark.h"
+#include "GESHandler.h"
+#include "GlobalEventSystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+
+void UGESBenchmarkReceiver::OnBenchFloat(float Value)
+{
+	Sum += Value;
+}
+
+namespace
+{
+	/** Emits a float event to Listeners native UFUNCTION listeners Emits times, returns ns per listener call */
+	double RunDispatchBenchmark(UWorld* World, int32 Listeners, int32 Emits, bool bNativeDispatch)
+	{
+		IConsoleVariable* NativeDispatch = IConsoleManager::Get().FindConsoleVariable(TEXT("ges.NativeDispatch"));
+		const int32 PreviousValue = NativeDispatch->GetInt();
+		NativeDispatch->Set(bNativeDispatch ? 1 : 0, ECVF_SetByCode);
+
+		//own domain so no game listeners are involved, removed again below
+		TSharedPtr<FGESHandler> Handler = FGESHandler::DefaultHandler();
+
+		TArray<UGESBenchmarkReceiver*> Receivers;
+		for (int32 i = 0; i < Listeners; i++)
+		{
+			UGESBenchmarkReceiver* Receiver = NewObject<UGESBenchmarkReceiver>(World);
+			Receiver->AddToRoot();
+			Receivers.Add(Receiver);
+
+			FGESEventListener Listener;
+			Listener.ReceiverWCO = Receiver;
+			Listener.FunctionName = TEXT("OnBenchFloat");
+			Listener.LinkFunction();
+			Handler->AddListener(TEXT("ges.bench"), TEXT("dispatch"), Listener);
+		}
+
+		FGESEmitContext Context;
+		Context.Domain = TEXT("ges.bench");
+		Context.Event = TEXT("dispatch");
+		Context.WorldContext = Receivers.Num() > 0 ? Receivers[0] : nullptr;
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Emits; i++)
+		{
+			Handler->EmitEvent(Context, 1.f);
+		}
+		const double Elapsed = FPlatformTime::Seconds() - Start;
+
+		for (UGESBenchmarkReceiver* Receiver : Receivers)
+		{
+			Handler->RemoveAllListenersForReceiver(Receiver);
+			Receiver->RemoveFromRoot();
+		}
+		Handler->DeleteEvent(Context.Domain, Context.Event);
+		NativeDispatch->Set(PreviousValue, ECVF_SetByCode);
+
+		return (Elapsed * 1e9) / FMath::Max<double>((double)Listeners * Emits, 1.0);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GESBenchNativeDispatchCommand(
+	TEXT("ges.BenchNativeDispatch"),
+	TEXT("ges.BenchNativeDispatch [Listeners=1000] [Emits=100]. Compares native thunk dispatch against ProcessEvent for UFUNCTION listeners."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			UE_LOG(LogGES, Warning, TEXT("ges.BenchNativeDispatch needs a world, run it in game or PIE."));
+			return;
+		}
+
+		const int32 Listeners = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000;
+		const int32 Emits = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 100;
+
+		//warm up both paths once
+		RunDispatchBenchmark(World, Listeners, 1, false);
+		RunDispatchBenchmark(World, Listeners, 1, true);
+
+		const double ProcessEventNs = RunDispatchBenchmark(World, Listeners, Emits, false);
+		const double NativeNs = RunDispatchBenchmark(World, Listeners, Emits, true);
+
+		UE_LOG(LogGES, Display, TEXT("ges.BenchNativeDispatch %d listeners x %d emits: ProcessEvent %.1f ns/call, native %.1f ns/call (%.1f%% saved)"),
+			Listeners, Emits, ProcessEventNs, NativeNs, ProcessEventNs > 0.0 ? (1.0 - NativeNs / ProcessEventNs) * 100.0 : 0.0);
+	}));
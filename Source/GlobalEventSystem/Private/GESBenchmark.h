@@ -0,0 +1,19 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "GESBenchmark.generated.h"
+
+/** Minimal native receiver used by the ges.Bench* console commands */
+UCLASS(Transient)
+class UGESBenchmarkReceiver : public UObject
+{
+	GENERATED_BODY()
+public:
+	UFUNCTION()
+	void OnBenchFloat(float Value);
+
+	float Sum = 0.f;
+};
@@ -0,0 +1,84 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GESDataTypes.h"
+#include "GESHandlerDataTypes.h"
+
+/** Emit copied for the listeners of a later delivery phase */
+struct FGESDeferredEmit
+{
+	FGESEmitContext Context;
+
+	//the emit is dropped if the emitter is gone by the time its phase comes up
+	TWeakObjectPtr<UObject> WorldContext;
+
+	FGESPollSlot Payload;
+
+	//object payloads aren't kept alive while queued, they are refreshed from this before delivery
+	bool bObjectPayload;
+	TWeakObjectPtr<UObject> ObjectPayload;
+
+	//located emits are replayed to the listeners in range at delivery time
+	bool bLocated;
+	FVector Location;
+	float Radius;
+
+	FGESDeferredEmit()
+	{
+		bObjectPayload = false;
+		bLocated = false;
+		Location = FVector::ZeroVector;
+		Radius = 0.f;
+	}
+};
+
+/** Drains one delivery phase of one world in the matching tick group */
+struct FGESPhaseTickFunction : public FTickFunction
+{
+	TFunction<void()> OnTick;
+	EGESDeliveryPhase Phase;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+	{
+		if (OnTick)
+		{
+			OnTick();
+		}
+	}
+
+	virtual FString DiagnosticMessage() override
+	{
+		return FString::Printf(TEXT("GES delivery phase %d"), (int32)Phase);
+	}
+};
+
+/**
+* Deferred deliveries of one world. Each phase after Immediate has a queue and a tick function, created the first
+* time a listener of that phase is reached in this world and removed with the world.
+*/
+struct FGESWorldPhases
+{
+	static constexpr int32 NumDeferredPhases = (int32)EGESDeliveryPhase::EndOfFrame;
+
+	//indexed by phase - 1
+	TArray<FGESDeferredEmit> Queues[NumDeferredPhases];
+	TUniquePtr<FGESPhaseTickFunction> TickFunctions[NumDeferredPhases];
+
+	static ETickingGroup TickGroup(EGESDeliveryPhase Phase)
+	{
+		switch (Phase)
+		{
+		case EGESDeliveryPhase::PrePhysics:
+			return TG_PrePhysics;
+		case EGESDeliveryPhase::PostPhysics:
+			return TG_PostPhysics;
+		case EGESDeliveryPhase::PostUpdateWork:
+			return TG_PostUpdateWork;
+		default:
+			return TG_LastDemotable;
+		}
+	}
+};
@@ -0,0 +1,518 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESEventRecorder.h"
+#include "GESHandler.h"
+#include "GESPayloadCodec.h"
+#include "GESWireFormat.h"
+#include "GlobalEventSystem.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Async/MappedFileHandle.h"
+#include "Containers/Queue.h"
+
+namespace
+{
+	//Size of u32 ChunkBytes + u32 RecordCount
+	constexpr int32 ChunkHeaderBytes = 8;
+
+	//Chunks waiting on the writer before new ones get dropped instead of growing memory
+	constexpr int32 MaxPendingChunks = 64;
+}
+
+/** Background thread appending finished chunks to the recording file */
+class FGESRecorderWriter : public FRunnable
+{
+public:
+	FGESRecorderWriter(IFileHandle* InFile)
+	{
+		File = InFile;
+		bStopping = false;
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("GESRecorderWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FGESRecorderWriter()
+	{
+		Stop();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		delete File;
+	}
+
+	virtual uint32 Run() override
+	{
+		while (true)
+		{
+			WritePending();
+			if (bStopping)
+			{
+				//anything submitted before stop is already queued
+				WritePending();
+				break;
+			}
+			WakeEvent->Wait(100);
+		}
+		File->Flush();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		WakeEvent->Trigger();
+	}
+
+	/** Game thread. Returns false if the chunk was dropped because the writer is behind. */
+	bool Submit(TArray<uint8>&& Chunk)
+	{
+		if (PendingChunks.GetValue() >= MaxPendingChunks)
+		{
+			DroppedChunks.Increment();
+			return false;
+		}
+		PendingChunks.Increment();
+		Queue.Enqueue(MoveTemp(Chunk));
+		WakeEvent->Trigger();
+		return true;
+	}
+
+	/** Game thread. Re-use a buffer the writer is done with, keeps its allocation. */
+	bool TryGetFreeChunk(TArray<uint8>& OutChunk)
+	{
+		return FreeChunks.Dequeue(OutChunk);
+	}
+
+	uint64 GetDroppedChunks() const
+	{
+		return (uint64)DroppedChunks.GetValue();
+	}
+
+private:
+	void WritePending()
+	{
+		TArray<uint8> Chunk;
+		while (Queue.Dequeue(Chunk))
+		{
+			File->Write(Chunk.GetData(), Chunk.Num());
+			PendingChunks.Decrement();
+			Chunk.Reset();
+			FreeChunks.Enqueue(MoveTemp(Chunk));
+		}
+	}
+
+	IFileHandle* File;
+	FRunnableThread* Thread;
+	FEvent* WakeEvent;
+	TAtomic<bool> bStopping;
+
+	TQueue<TArray<uint8>, EQueueMode::Spsc> Queue;
+	TQueue<TArray<uint8>, EQueueMode::Spsc> FreeChunks;
+	FThreadSafeCounter PendingChunks;
+	FThreadSafeCounter DroppedChunks;
+};
+
+FGESEventRecorder::FGESEventRecorder()
+{
+	ChunkRecordCount = 0;
+	ChunkBytes = 0;
+	StartTime = 0.0;
+	RecordedCount = 0;
+}
+
+FGESEventRecorder::~FGESEventRecorder()
+{
+	Stop();
+}
+
+bool FGESEventRecorder::Start(const FString& FilePath, TSharedPtr<FGESHandler> InHandler, int32 InChunkBytes)
+{
+	Stop();
+
+	if (!InHandler.IsValid())
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESEventRecorder::Start No valid handler provided."));
+		return false;
+	}
+
+	IFileHandle* File = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath);
+	if (!File)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESEventRecorder::Start Could not open %s for writing."), *FilePath);
+		return false;
+	}
+
+	//the only write on the game thread, once per recording
+	TArray<uint8> FileHeader;
+	FGESPayloadCodec::AppendValue<uint32>(FileHeader, GESWire::RecordingMagic);
+	FGESPayloadCodec::AppendValue<uint32>(FileHeader, GESWire::RecordingVersion);
+	File->Write(FileHeader.GetData(), FileHeader.Num());
+
+	Writer = MakeUnique<FGESRecorderWriter>(File);
+	ChunkBytes = FMath::Max(InChunkBytes, 1024);
+	KeyIds.Empty();
+	RecordedCount = 0;
+	StartTime = FPlatformTime::Seconds();
+	BeginChunk();
+
+	Handler = InHandler;
+	EmitHandle = InHandler->OnEmit.AddRaw(this, &FGESEventRecorder::HandleEmit);
+	return true;
+}
+
+void FGESEventRecorder::Stop()
+{
+	TSharedPtr<FGESHandler> PinnedHandler = Handler.Pin();
+	if (PinnedHandler.IsValid() && EmitHandle.IsValid())
+	{
+		PinnedHandler->OnEmit.Remove(EmitHandle);
+	}
+	EmitHandle.Reset();
+	Handler.Reset();
+
+	if (Writer.IsValid())
+	{
+		if (ChunkRecordCount > 0)
+		{
+			SubmitChunk();
+		}
+
+		//joins the writer thread after it drained the queue
+		Writer.Reset();
+	}
+	Chunk.Empty();
+	ChunkRecordCount = 0;
+}
+
+bool FGESEventRecorder::IsRecording() const
+{
+	return Writer.IsValid();
+}
+
+uint64 FGESEventRecorder::GetRecordedCount() const
+{
+	return RecordedCount;
+}
+
+uint64 FGESEventRecorder::GetDroppedChunkCount() const
+{
+	return Writer.IsValid() ? Writer->GetDroppedChunks() : 0;
+}
+
+void FGESEventRecorder::BeginChunk()
+{
+	if (!Writer->TryGetFreeChunk(Chunk))
+	{
+		Chunk.Reset();
+		Chunk.Reserve(ChunkBytes + ChunkHeaderBytes);
+	}
+
+	//header gets patched on submit
+	Chunk.AddZeroed(ChunkHeaderBytes);
+	ChunkRecordCount = 0;
+}
+
+void FGESEventRecorder::SubmitChunk()
+{
+	const uint32 Bytes = (uint32)(Chunk.Num() - ChunkHeaderBytes);
+	FMemory::Memcpy(Chunk.GetData(), &Bytes, sizeof(uint32));
+	FMemory::Memcpy(Chunk.GetData() + sizeof(uint32), &ChunkRecordCount, sizeof(uint32));
+
+	if (!Writer->Submit(MoveTemp(Chunk)))
+	{
+		//key definitions in the dropped chunk are lost, redefine keys on next use
+		KeyIds.Empty();
+	}
+	Chunk = TArray<uint8>();
+	ChunkRecordCount = 0;
+}
+
+void FGESEventRecorder::HandleEmit(const FGESPropertyEmitContext& EmitData)
+{
+	const FString KeyString = FGESHandler::Key(EmitData.Domain, EmitData.Event);
+
+	uint32 KeyId;
+	if (const uint32* ExistingId = KeyIds.Find(KeyString))
+	{
+		KeyId = *ExistingId;
+	}
+	else
+	{
+		KeyId = (uint32)KeyIds.Num();
+		KeyIds.Add(KeyString, KeyId);
+
+		FGESPayloadCodec::AppendValue<uint8>(Chunk, (uint8)GESWire::ERecordType::KeyDefinition);
+		FGESPayloadCodec::AppendValue<uint32>(Chunk, KeyId);
+		FGESPayloadCodec::EncodeString(EmitData.Domain, Chunk);
+		FGESPayloadCodec::EncodeString(EmitData.Event, Chunk);
+		ChunkRecordCount++;
+	}
+
+	FGESPayloadCodec::AppendValue<uint8>(Chunk, (uint8)GESWire::ERecordType::Emit);
+	FGESPayloadCodec::AppendValue<uint32>(Chunk, KeyId);
+	FGESPayloadCodec::AppendValue<uint64>(Chunk, (uint64)GFrameCounter);
+	FGESPayloadCodec::AppendValue<double>(Chunk, FPlatformTime::Seconds() - StartTime);
+	FGESPayloadCodec::AppendValue<uint8>(Chunk, EmitData.bPinned ? 1 : 0);
+	FGESPayloadCodec::EncodePayload(EmitData.Property, EmitData.PropertyPtr, Chunk);
+	ChunkRecordCount++;
+	RecordedCount++;
+
+	if (Chunk.Num() >= ChunkBytes)
+	{
+		SubmitChunk();
+		BeginChunk();
+	}
+}
+
+FGESEventPlayer::FGESEventPlayer()
+{
+	Data = nullptr;
+	DataNum = 0;
+	Cursor = 0;
+	ChunkEnd = 0;
+	Pending.bValid = false;
+	Pending.Seconds = 0.0;
+	Pending.Frame = 0;
+	PendingPayload = MakeUnique<FGESDecodedPayload>();
+	TimeScale = 1.f;
+	PlaybackSeconds = 0.0;
+	PlayedCount = 0;
+}
+
+FGESEventPlayer::~FGESEventPlayer()
+{
+	Close();
+}
+
+bool FGESEventPlayer::Open(const FString& FilePath)
+{
+	Close();
+
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (!MappedHandle.IsValid())
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESEventPlayer::Open Could not map %s."), *FilePath);
+		return false;
+	}
+	MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	if (!MappedRegion.IsValid())
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESEventPlayer::Open Could not map a region of %s."), *FilePath);
+		Close();
+		return false;
+	}
+
+	Data = MappedRegion->GetMappedPtr();
+	DataNum = (uint64)MappedRegion->GetMappedSize();
+
+	GESWire::FReader Reader(Data, (uint32)FMath::Min<uint64>(DataNum, ChunkHeaderBytes));
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	if (!Reader.Read(Magic) || !Reader.Read(Version) ||
+		Magic != GESWire::RecordingMagic || Version < 1 || Version > GESWire::RecordingVersion)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESEventPlayer::Open %s is not a GES recording (or a different version)."), *FilePath);
+		Close();
+		return false;
+	}
+
+	Rewind();
+	return true;
+}
+
+void FGESEventPlayer::Close()
+{
+	Stop();
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	Data = nullptr;
+	DataNum = 0;
+	Pending.bValid = false;
+}
+
+void FGESEventPlayer::Rewind()
+{
+	//skip file header
+	Cursor = 8;
+	ChunkEnd = Cursor;
+	KeyTable.Reset();
+	PlayedCount = 0;
+	Pending.bValid = ReadNextEmit();
+	PlaybackSeconds = Pending.bValid ? Pending.Seconds : 0.0;
+}
+
+bool FGESEventPlayer::Play(TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext, float InTimeScale)
+{
+	Stop();
+	if (!Data || !InHandler.IsValid())
+	{
+		return false;
+	}
+
+	Handler = InHandler;
+	WorldContext = InWorldContext;
+	TimeScale = FMath::Max(InTimeScale, KINDA_SMALL_NUMBER);
+
+	//time starts at the first recorded event
+	PlaybackSeconds = Pending.bValid ? Pending.Seconds : 0.0;
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGESEventPlayer::Tick));
+	return true;
+}
+
+void FGESEventPlayer::Stop()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+}
+
+bool FGESEventPlayer::IsPlaying() const
+{
+	return TickHandle.IsValid();
+}
+
+int32 FGESEventPlayer::ReplayAll(TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext)
+{
+	Stop();
+	if (!Data || !InHandler.IsValid())
+	{
+		return 0;
+	}
+	Handler = InHandler;
+	WorldContext = InWorldContext;
+
+	int32 Count = 0;
+	while (Pending.bValid)
+	{
+		EmitPending();
+		Count++;
+		Pending.bValid = ReadNextEmit();
+	}
+	return Count;
+}
+
+uint64 FGESEventPlayer::GetPlayedCount() const
+{
+	return PlayedCount;
+}
+
+bool FGESEventPlayer::Tick(float DeltaTime)
+{
+	PlaybackSeconds += DeltaTime * TimeScale;
+
+	while (Pending.bValid && Pending.Seconds <= PlaybackSeconds)
+	{
+		EmitPending();
+		Pending.bValid = ReadNextEmit();
+	}
+
+	if (!Pending.bValid)
+	{
+		//done, returning false removes us from the ticker
+		TickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FGESEventPlayer::EmitPending()
+{
+	TSharedPtr<FGESHandler> PinnedHandler = Handler.Pin();
+	if (!PinnedHandler.IsValid() || !WorldContext.IsValid())
+	{
+		return;
+	}
+	Pending.Context.WorldContext = WorldContext.Get();
+	FGESPayloadCodec::EmitDecodedPayload(*PinnedHandler, Pending.Context, *PendingPayload);
+	PlayedCount++;
+}
+
+bool FGESEventPlayer::ReadNextEmit()
+{
+	while (Data)
+	{
+		//next chunk
+		if (Cursor >= ChunkEnd)
+		{
+			if (Cursor + ChunkHeaderBytes > DataNum)
+			{
+				return false;
+			}
+			uint32 Bytes = 0;
+			FMemory::Memcpy(&Bytes, Data + Cursor, sizeof(uint32));
+			Cursor += ChunkHeaderBytes;
+			ChunkEnd = Cursor + Bytes;
+			if (ChunkEnd > DataNum)
+			{
+				UE_LOG(LogGES, Warning, TEXT("FGESEventPlayer::ReadNextEmit truncated chunk, playback ends here."));
+				return false;
+			}
+			continue;
+		}
+
+		GESWire::FReader Reader(Data + Cursor, (uint32)(ChunkEnd - Cursor));
+		uint8 RecordType = 0;
+		Reader.Read(RecordType);
+
+		if (RecordType == (uint8)GESWire::ERecordType::KeyDefinition)
+		{
+			uint32 KeyId = 0;
+			FGESEventContext Key;
+			if (!Reader.Read(KeyId) ||
+				!FGESPayloadCodec::DecodeString(Reader, Key.Domain) ||
+				!FGESPayloadCodec::DecodeString(Reader, Key.Event))
+			{
+				break;
+			}
+			//ids are defined in order, anything past the next one is a corrupt file
+			if (KeyId > (uint32)KeyTable.Num())
+			{
+				break;
+			}
+			if (KeyId == (uint32)KeyTable.Num())
+			{
+				KeyTable.AddDefaulted();
+			}
+			KeyTable[KeyId] = Key;
+			Cursor += Reader.Offset;
+			continue;
+		}
+		else if (RecordType == (uint8)GESWire::ERecordType::Emit)
+		{
+			uint32 KeyId = 0;
+			uint8 bPinned = 0;
+			Reader.Read(KeyId);
+			Reader.Read(Pending.Frame);
+			Reader.Read(Pending.Seconds);
+			Reader.Read(bPinned);
+
+			*PendingPayload = FGESDecodedPayload();
+			if (Reader.bError || !KeyTable.IsValidIndex((int32)KeyId) ||
+				!FGESPayloadCodec::DecodePayload(Reader, *PendingPayload))
+			{
+				break;
+			}
+			Pending.Context.Domain = KeyTable[KeyId].Domain;
+			Pending.Context.Event = KeyTable[KeyId].Event;
+			Pending.Context.bPinned = bPinned != 0;
+			Cursor += Reader.Offset;
+			return true;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	UE_LOG(LogGES, Warning, TEXT("FGESEventPlayer::ReadNextEmit malformed record at offset %llu, playback ends here."), Cursor);
+	return false;
+}
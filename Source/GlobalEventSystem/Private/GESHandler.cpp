@@ -1,12 +1,307 @@
 #include "GESHandler.h"
+#include "GlobalEventSystem.h"
 #include "GlobalEventSystemBPLibrary.h"
+#include "GESPropertyPool.h"
+#include "GESTimerWheel.h"
+#include "GESWorldSchedule.h"
+#include "GESDeliveryPhases.h"
+#include "GESSpatialIndex.h"
+#include "GESScopeComponent.h"
 #include "Engine/World.h"
+#include "Misc/StringBuilder.h"
+#include "Engine/Level.h"
 
 TSharedPtr<FGESHandler> FGESHandler::PrivateDefaultHandler = MakeShareable(new FGESHandler());
+TMap<FName, TSharedPtr<FGESHandler>> FGESHandler::PrivateBuses;
+TMap<FGESHandler*, TWeakPtr<FGESHandler>> FGESHandler::PrivateScopedBuses;
+TArray<TPair<FString, FName>> FGESHandler::PrivateRoutes;
+TMap<FString, TSharedPtr<FGESHandler>> FGESHandler::PrivateRouteCache;
+int32 FGESHandler::CurrentRequestId = -1;
+uint16 FGESHandler::NextRequestGeneration = 1;
+int32 FGESHandler::NextJoinId = 0;
+int32 FGESHandler::NextScheduleId = 0;
+
+//Property types EmitPropertyEvent forwards to listeners
+static const EClassCastFlags SupportedEmitCastFlags =
+	CASTCLASS_FStructProperty |
+	CASTCLASS_FStrProperty |
+	CASTCLASS_FObjectProperty |
+	CASTCLASS_FNumericProperty |
+	CASTCLASS_FBoolProperty |
+	CASTCLASS_FNameProperty |
+	CASTCLASS_FArrayProperty |
+	CASTCLASS_FMapProperty |
+	CASTCLASS_FSetProperty;
+
+static bool IsJoinSatisfied(const FGESJoin& Join)
+{
+	if (Join.Definition.Mode == EGESJoinMode::Any)
+	{
+		return Join.ReceivedMask != 0;
+	}
+	return Join.ReceivedMask == Join.CompleteMask;
+}
+
+//Heap memory owned by a value (string and container allocations), the value's own size is counted by the caller
+static SIZE_T ValueHeapBytes(const FProperty* Property, const void* ValuePtr)
+{
+	if (Property == nullptr || ValuePtr == nullptr)
+	{
+		return 0;
+	}
+
+	SIZE_T Bytes = 0;
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		Bytes += StrProperty->GetPropertyValue(ValuePtr).GetAllocatedSize();
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Array(ArrayProperty, ValuePtr);
+		Bytes += (SIZE_T)Array.Num() * ArrayProperty->Inner->GetSize();
+		for (int32 i = 0; i < Array.Num(); i++)
+		{
+			Bytes += ValueHeapBytes(ArrayProperty->Inner, Array.GetRawPtr(i));
+		}
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Map(MapProperty, ValuePtr);
+		Bytes += (SIZE_T)Map.Num() * (MapProperty->KeyProp->GetSize() + MapProperty->ValueProp->GetSize());
+		for (int32 i = 0; i < Map.GetMaxIndex(); i++)
+		{
+			if (Map.IsValidIndex(i))
+			{
+				Bytes += ValueHeapBytes(MapProperty->KeyProp, Map.GetKeyPtr(i));
+				Bytes += ValueHeapBytes(MapProperty->ValueProp, Map.GetValuePtr(i));
+			}
+		}
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Set(SetProperty, ValuePtr);
+		Bytes += (SIZE_T)Set.Num() * SetProperty->ElementProp->GetSize();
+		for (int32 i = 0; i < Set.GetMaxIndex(); i++)
+		{
+			if (Set.IsValidIndex(i))
+			{
+				Bytes += ValueHeapBytes(SetProperty->ElementProp, Set.GetElementPtr(i));
+			}
+		}
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ArrayIndex++)
+			{
+				Bytes += ValueHeapBytes(*It, It->ContainerPtrToValuePtr<void>(ValuePtr, ArrayIndex));
+			}
+		}
+	}
+	return Bytes;
+}
+
+static FString MemoryString(SIZE_T Bytes)
+{
+	return FString::Printf(TEXT("%.1f KB"), Bytes / 1024.0);
+}
+
+static TAutoConsoleVariable<int32> CVarGESNativeDispatch(
+	TEXT("ges.NativeDispatch"),
+	1,
+	TEXT("1 calls native UFUNCTION listeners through their thunk directly, 0 always uses ProcessEvent."));
+
+static TAutoConsoleVariable<int32> CVarGESCompactBudget(
+	TEXT("ges.CompactBudget"),
+	64,
+	TEXT("Events checked per tick when removing events that lost their last listener, pin or poll reader. 0 keeps them."));
+
+static TAutoConsoleVariable<float> CVarGESSpatialCellSize(
+	TEXT("ges.SpatialCellSize"),
+	1000.f,
+	TEXT("Cell size in world units of the listener grids used by located emits, about the typical emit radius. Applies to grids created afterwards."));
 
 void FGESHandler::Clear()
 {
 	PrivateDefaultHandler = MakeShareable(new FGESHandler());
+
+	//buses are recreated on next use, routes stay
+	PrivateBuses.Empty();
+	PrivateRouteCache.Empty();
+}
+
+TSharedPtr<FGESHandler> FGESHandler::Bus(const FName& BusName)
+{
+	if (BusName.IsNone())
+	{
+		return PrivateDefaultHandler;
+	}
+
+	TSharedPtr<FGESHandler>* Found = PrivateBuses.Find(BusName);
+	if (Found)
+	{
+		return *Found;
+	}
+
+	TSharedPtr<FGESHandler> NewBus = MakeShareable(new FGESHandler());
+	NewBus->BusName = BusName;
+	PrivateBuses.Add(BusName, NewBus);
+	return NewBus;
+}
+
+void FGESHandler::RouteDomain(const FString& DomainPrefix, const FName& BusName)
+{
+	PrivateRoutes.RemoveAll([&DomainPrefix](const TPair<FString, FName>& Route)
+	{
+		return Route.Key == DomainPrefix;
+	});
+	if (!BusName.IsNone())
+	{
+		PrivateRoutes.Add(TPair<FString, FName>(DomainPrefix, BusName));
+		PrivateRoutes.StableSort([](const TPair<FString, FName>& A, const TPair<FString, FName>& B)
+		{
+			return A.Key.Len() > B.Key.Len();
+		});
+	}
+	PrivateRouteCache.Empty();
+}
+
+TSharedPtr<FGESHandler> FGESHandler::ForDomain(const FString& Domain)
+{
+	if (PrivateRoutes.Num() == 0)
+	{
+		return PrivateDefaultHandler;
+	}
+
+	TSharedPtr<FGESHandler>* Cached = PrivateRouteCache.Find(Domain);
+	if (Cached)
+	{
+		return *Cached;
+	}
+
+	TSharedPtr<FGESHandler> Handler = PrivateDefaultHandler;
+	for (const TPair<FString, FName>& Route : PrivateRoutes)
+	{
+		//whole domain segments only, 'ui' matches 'ui' and 'ui.menu' but not 'uinput'
+		if (Domain.StartsWith(Route.Key, ESearchCase::CaseSensitive) &&
+			(Domain.Len() == Route.Key.Len() || Domain[Route.Key.Len()] == TEXT('.')))
+		{
+			Handler = Bus(Route.Value);
+			break;
+		}
+	}
+	PrivateRouteCache.Add(Domain, Handler);
+	return Handler;
+}
+
+//domain reserved for actor scoped events, see ForDomain(Domain, Context)
+static const TCHAR* ActorScopeDomain = TEXT("actor");
+
+static AActor* ScopeActor(UObject* ScopeObject)
+{
+	AActor* Actor = Cast<AActor>(ScopeObject);
+	if (!Actor && ScopeObject)
+	{
+		//components and other actor owned objects
+		Actor = ScopeObject->GetTypedOuter<AActor>();
+	}
+	return Actor;
+}
+
+static bool IsActorScopeDomain(const FString& Domain)
+{
+	const int32 ScopeLen = FCString::Strlen(ActorScopeDomain);
+	return Domain.StartsWith(ActorScopeDomain, ESearchCase::CaseSensitive) &&
+		(Domain.Len() == ScopeLen || Domain[ScopeLen] == TEXT('.'));
+}
+
+TSharedPtr<FGESHandler> FGESHandler::ForDomain(const FString& Domain, UObject* Context)
+{
+	if (IsActorScopeDomain(Domain))
+	{
+		return ForScope(Context);
+	}
+	return ForDomain(Domain);
+}
+
+TSharedPtr<FGESHandler> FGESHandler::FindForDomain(const FString& Domain, UObject* Context)
+{
+	if (IsActorScopeDomain(Domain))
+	{
+		return FindScope(Context);
+	}
+	return ForDomain(Domain);
+}
+
+TSharedPtr<FGESHandler> FGESHandler::ForScope(UObject* ScopeObject)
+{
+	AActor* Actor = ScopeActor(ScopeObject);
+	if (!Actor || !Actor->GetWorld() || Actor->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::ForScope %s is not part of a spawned actor, using the default handler."), *GetNameSafe(ScopeObject));
+		return PrivateDefaultHandler;
+	}
+
+	UGESScopeComponent* Scope = Actor->FindComponentByClass<UGESScopeComponent>();
+	if (!Scope)
+	{
+		Scope = NewObject<UGESScopeComponent>(Actor);
+		Scope->RegisterComponent();
+	}
+	return Scope->GetBus();
+}
+
+TSharedPtr<FGESHandler> FGESHandler::FindScope(UObject* ScopeObject)
+{
+	AActor* Actor = ScopeActor(ScopeObject);
+	UGESScopeComponent* Scope = Actor ? Actor->FindComponentByClass<UGESScopeComponent>() : nullptr;
+	return Scope ? Scope->FindBus() : nullptr;
+}
+
+void FGESHandler::ForEachHandler(TFunctionRef<void(FGESHandler&)> Func, bool bIncludeScoped /*= false*/)
+{
+	//copy, Func may create buses
+	TArray<TSharedPtr<FGESHandler>> Handlers;
+	PrivateBuses.GenerateValueArray(Handlers);
+	Handlers.Insert(PrivateDefaultHandler, 0);
+
+	if (bIncludeScoped)
+	{
+		for (const TPair<FGESHandler*, TWeakPtr<FGESHandler>>& Pair : PrivateScopedBuses)
+		{
+			TSharedPtr<FGESHandler> ScopedBus = Pair.Value.Pin();
+			if (ScopedBus.IsValid())
+			{
+				Handlers.Add(ScopedBus);
+			}
+		}
+	}
+
+	for (TSharedPtr<FGESHandler>& Handler : Handlers)
+	{
+		Func(*Handler);
+	}
+}
+
+TSharedPtr<FGESHandler> FGESHandler::ForRequest(int32 RequestId)
+{
+	for (const TPair<FName, TSharedPtr<FGESHandler>>& Pair : PrivateBuses)
+	{
+		if (Pair.Value->FindRequestIndex(RequestId) != INDEX_NONE)
+		{
+			return Pair.Value;
+		}
+	}
+	for (const TPair<FGESHandler*, TWeakPtr<FGESHandler>>& Pair : PrivateScopedBuses)
+	{
+		TSharedPtr<FGESHandler> ScopedBus = Pair.Value.Pin();
+		if (ScopedBus.IsValid() && ScopedBus->FindRequestIndex(RequestId) != INDEX_NONE)
+		{
+			return ScopedBus;
+		}
+	}
+	return PrivateDefaultHandler;
 }
 
 bool FGESHandler::FirstParamIsCppType(UFunction* Function, const FString& TypeString)
@@ -35,7 +330,7 @@ bool FGESHandler::FirstParamIsSubclassOf(UFunction* Function, FFieldClass* Class
 
 FString FGESHandler::ListenerLogString(const FGESEventListener& Listener)
 {
-	return Listener.ReceiverWCO.Get()->GetName() + TEXT(":") + Listener.FunctionName;
+	return Listener.ReceiverWCO.Get()->GetName() + TEXT(":") + Listener.FunctionName.ToString();
 }
 
 FString FGESHandler::EventLogString(const FGESEvent& Event)
@@ -60,20 +355,103 @@ void FGESHandler::FunctionParameters(UFunction* Function, TArray<FProperty*>& Ou
 	}
 }
 
-bool FGESHandler::FunctionHasValidParams(UFunction* Function, FFieldClass* ClassType, const FGESEmitContext& EmitData, const FGESEventListener& Listener)
+bool FGESHandler::FunctionHasValidParams(FFieldClass* ClassType, const FGESEmitContext& EmitData, const FGESEventListener& Listener)
 {
-	if (FirstParamIsSubclassOf(Function, ClassType))
+	FProperty* FirstParam = Listener.GetFirstParam();
+	if (FirstParam && FirstParam->GetClass()->IsChildOf(ClassType))
 	{
 		return true;
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s due to function not having a matching %s signature."),
+#if GES_EMIT_LOGGING
+		//Only report a mismatch once per listener, not on every emit
+		if (!Listener.bLoggedParamMismatch)
+		{
+			Listener.bLoggedParamMismatch = true;
+			UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s due to function not having a matching %s signature."),
+				*EmitEventLogString(EmitData),
+				*ListenerLogString(Listener),
+				*ClassType->GetName());
+		}
+#endif
+		return false;
+	}
+}
+
+bool FGESHandler::FunctionAcceptsObject(UObject* Object, const FGESEmitContext& EmitData, const FGESEventListener& Listener)
+{
+	FObjectPropertyBase* ObjectParam = CastField<FObjectPropertyBase>(Listener.GetFirstParam());
+	if (!Object || !ObjectParam || Object->IsA(ObjectParam->PropertyClass))
+	{
+		return true;
+	}
+#if GES_EMIT_LOGGING
+	if (!Listener.bLoggedParamMismatch)
+	{
+		Listener.bLoggedParamMismatch = true;
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s, %s is not a %s."),
 			*EmitEventLogString(EmitData),
 			*ListenerLogString(Listener),
-			*ClassType->GetName());
-		return false;
+			*Object->GetName(),
+			*ObjectParam->PropertyClass->GetName());
+	}
+#endif
+	return false;
+}
+
+bool FGESHandler::FunctionHasMatchingContainerParam(const FGESPropertyEmitContext& EmitData, const FGESEventListener& Listener)
+{
+	FProperty* FirstParam = Listener.GetFirstParam();
+	if (FirstParam && FirstParam->SameType(EmitData.Property))
+	{
+		return true;
+	}
+#if GES_EMIT_LOGGING
+	if (!Listener.bLoggedParamMismatch)
+	{
+		Listener.bLoggedParamMismatch = true;
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s due to function not having a matching %s signature."),
+			*EmitEventLogString(EmitData),
+			*ListenerLogString(Listener),
+			*EmitData.Property->GetCPPType());
+	}
+#endif
+	return false;
+}
+
+void FGESHandler::CallListenerFunction(const FGESEventListener& Listener, void* Parms) const
+{
+	UObject* Receiver = Listener.ReceiverWCO.Get();
+	UFunction* Function = Listener.GetFunction();
+
+	if (!Listener.bIsNativeFunction || !Options.bUseNativeDispatch || CVarGESNativeDispatch.GetValueOnGameThread() == 0)
+	{
+		Receiver->ProcessEvent(Function, Parms);
+		return;
+	}
+
+	//Same frame ProcessEvent would build for a native function, without its generic call bookkeeping
+	FFrame Frame(Receiver, Function, Parms, nullptr, Function->ChildProperties);
+
+	FOutParmRec OutParm;
+	FProperty* OutParam = Listener.GetOutParam();
+	if (OutParam)
+	{
+		OutParm.Property = OutParam;
+		OutParm.PropAddr = (uint8*)Parms;
+		OutParm.NextOutParm = nullptr;
+		Frame.OutParms = &OutParm;
 	}
+
+	Function->Invoke(Receiver, Frame, nullptr);
+}
+
+bool FGESHandler::IsContainerProperty(FProperty* Property)
+{
+	return Property->IsA<FArrayProperty>() ||
+		Property->IsA<FMapProperty>() ||
+		Property->IsA<FSetProperty>();
 }
 
 TSharedPtr<FGESHandler> FGESHandler::DefaultHandler()
@@ -83,6 +461,7 @@ TSharedPtr<FGESHandler> FGESHandler::DefaultHandler()
 
 void FGESHandler::CreateEvent(const FString& Domain, const FString& Event, bool bPinned /*= false*/)
 {
+	LLM_SCOPE_BYTAG(GES);
 	FGESEvent CreatedFunction;
 	CreatedFunction.Domain = Domain;
 	CreatedFunction.Event = Event;
@@ -116,740 +495,2440 @@ bool FGESHandler::HasEvent(const FString& Domain, const FString& Event)
 	return EventMap.Contains(Key(Domain, Event));
 }
 
-void FGESHandler::UnpinEvent(const FString& Domain, const FString& EventName)
+const FGESEvent* FGESHandler::FindEvent(const FString& Domain, const FString& Event) const
 {
-	FString KeyString = Key(Domain, EventName);
-	if (EventMap.Contains(KeyString))
+	//Key() without the allocation, the stack buffer covers typical keys
+	TStringBuilder<128> KeyString;
+	KeyString << Domain << TEXT('.') << Event;
+	const TCHAR* KeyChars = KeyString.ToString();
+
+	//same hash FString keys get, matched with FString == TCHAR*
+	return EventMap.FindByHash(FCrc::Strihash_DEPRECATED(KeyChars), KeyChars);
+}
+
+bool FGESHandler::HasListeners(const FString& Domain, const FString& Event) const
+{
+	const FGESEvent* FoundEvent = FindEvent(Domain, Event);
+	return FoundEvent && FoundEvent->Listeners.Num() > 0;
+}
+
+bool FGESHandler::WantsEmit(const FGESEmitContext& EmitData) const
+{
+	if (EmitData.bPinned || OnEmit.IsBound())
 	{
-		FGESEvent& Event = EventMap[KeyString];
-		Event.bPinned = false;
-		//Event.PinnedData.Property->RemoveFromRoot();
-		//Event.PinnedData.PropertyData.Empty();  not sure if safe to delete instead of rebuilding on next pin
+		return true;
 	}
+	const FGESEvent* FoundEvent = FindEvent(EmitData.Domain, EmitData.Event);
+
+	//a non-pinned emit to a pinned event unpins it, so that one still has to go through
+	return FoundEvent && (FoundEvent->bPinned || FoundEvent->Listeners.Num() > 0 || FoundEvent->PollSlot.ReaderCount > 0);
 }
 
-void FGESHandler::AddListener(const FString& Domain, const FString& EventName, const FGESEventListener& Listener)
+bool FGESHandler::IsEventPinned(const FString& Domain, const FString& Event)
 {
-	FString KeyString = Key(Domain, EventName);
+	const FGESEvent* FoundEvent = FindEvent(Domain, Event);
+	return FoundEvent && FoundEvent->bPinned;
+}
 
-	//Create event if not already created
-	if (!EventMap.Contains(KeyString))
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, FGESWildcardProperty& OutProperty, uint32* OutVersion /*= nullptr*/)
+{
+	const FGESEvent* FoundEvent = FindEvent(Domain, Event);
+	if (OutVersion)
 	{
-		CreateEvent(Domain, EventName);
+		*OutVersion = FoundEvent ? FoundEvent->PinnedVersion : 0;
 	}
 
-	//Check passed listener validity
-	if (Listener.IsValidListener())
+	//same staleness rule as pinned delivery to new listeners
+	if (!FoundEvent || !FoundEvent->bPinned || !FoundEvent->WorldContext || !FoundEvent->WorldContext->IsValidLowLevel())
 	{
-		//Actually add this valid listener to map
-		FGESEvent& Event = EventMap[KeyString];
-		Event.Listeners.Add(Listener);
+		return false;
+	}
+
+	OutProperty.Property = FoundEvent->PinnedData.Property;
+	OutProperty.PropertyPtr = FoundEvent->PinnedData.PropertyPtr;
+	return true;
+}
+
+//Copy a pinned value into a caller property, allowing the conversions blueprint users expect (float pins are doubles)
+static bool CopyPinnedValue(FProperty* FromProperty, const void* FromPtr, FProperty* ToProperty, void* ToPtr)
+{
+	if (!FromProperty || !FromPtr || !ToProperty || !ToPtr)
+	{
+		return false;
+	}
 
-		//TODO: check receivermap logic
-		FGESEventListenerWithContext ListenContext;
-		ListenContext.Domain = Domain;
-		ListenContext.Event = EventName;
-		FGESMinimalEventListener Minimal;
-		Minimal.FunctionName = Listener.FunctionName;
-		Minimal.ReceiverWCO = Listener.ReceiverWCO;
-		ListenContext.Listener = Minimal;
+	if (FromProperty->SameType(ToProperty))
+	{
+		ToProperty->CopyCompleteValue(ToPtr, FromPtr);
+		return true;
+	}
 
-		if (!ReceiverMap.Contains(Listener.ReceiverWCO.Get()))
+	FNumericProperty* FromNumeric = CastField<FNumericProperty>(FromProperty);
+	FNumericProperty* ToNumeric = CastField<FNumericProperty>(ToProperty);
+	if (FromNumeric && ToNumeric && !FromNumeric->IsEnum() && !ToNumeric->IsEnum())
+	{
+		if (ToNumeric->IsFloatingPoint())
 		{
-			TArray<FGESEventListenerWithContext> Array;
-			ReceiverMap.Add(Listener.ReceiverWCO.Get(), Array);
+			const double Value = FromNumeric->IsFloatingPoint() ?
+				FromNumeric->GetFloatingPointPropertyValue(FromPtr) :
+				(double)FromNumeric->GetSignedIntPropertyValue(FromPtr);
+			ToNumeric->SetFloatingPointPropertyValue(ToPtr, Value);
+			return true;
 		}
-		ReceiverMap[Listener.ReceiverWCO.Get()].Add(ListenContext);
-
-		//if it's pinned re-emit it immediately to this listener
-		if (Event.bPinned) 
+		if (ToNumeric->IsInteger() && FromNumeric->IsInteger())
 		{
-			FGESPropertyEmitContext EmitData;
-			
-			EmitData.Domain = Domain;
-			EmitData.Event = EventName;
-
-			EmitData.Property = Event.PinnedData.Property;
-			EmitData.PropertyPtr = Event.PinnedData.PropertyPtr;
-			EmitData.bPinned = Event.bPinned;
-			EmitData.SpecificTarget = (FGESEventListener*)&Listener;	//this immediate call should only be calling our listener
-			EmitData.WorldContext = Event.WorldContext;
-			
-			//did we fail to emit?
-			if (!EmitPropertyEvent(EmitData))
-			{
-				//did the event get removed due to being stale? The listener may still be valid so re-run this add listener loop
-				if (!HasEvent(Domain, EventName))
-				{
-					AddListener(Domain, EventName, Listener);
-				}
-			}
+			ToNumeric->SetIntPropertyValue(ToPtr, FromNumeric->GetSignedIntPropertyValue(FromPtr));
+			return true;
 		}
+		return false;
 	}
-	else
-	{
-		//NB: validity can be violated due to delegate and lambda too
-		//TODO: add warnings in case of invalid delegate/lambda function binds
 
-		//Not valid, emit warnings
-		if (Listener.ReceiverWCO->IsValidLowLevelFast())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("FGESHandler::AddListener Warning: \n%s does not have the function '%s'. Attempted to bind to GESEvent %s.%s"), *Listener.ReceiverWCO->GetFullName(), *Listener.FunctionName, *Domain, *EventName);
-		}
-		else
+	FObjectPropertyBase* FromObject = CastField<FObjectPropertyBase>(FromProperty);
+	FObjectPropertyBase* ToObject = CastField<FObjectPropertyBase>(ToProperty);
+	if (FromObject && ToObject)
+	{
+		UObject* Object = FromObject->GetObjectPropertyValue(FromPtr);
+		if (Object && !Object->IsA(ToObject->PropertyClass))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("FGESHandler::AddListener: (invalid object) does not have the function '%s'. Attempted to bind to GESEvent %s.%s"), *Listener.FunctionName, *Domain, *EventName);
+			return false;
 		}
+		ToObject->SetObjectPropertyValue(ToPtr, Object);
+		return true;
 	}
+
+	return false;
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext Context, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda)
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, FProperty* OutProperty, void* OutPtr, uint32* OutVersion /*= nullptr*/)
 {
-	if (Context.WorldContext == nullptr)
+	FGESWildcardProperty Pinned;
+	if (!TryGetPinned(Domain, Event, Pinned, OutVersion))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FGESHandler::AddLambdaListener No valid world context provided. Not added."));
-		return TEXT("Invalid");
+		return false;
 	}
-	FGESEventListener Listener;
-	Listener.bIsBoundToLambda = true;
-	Listener.LambdaFunction = ReceivingLambda;
-	Listener.ReceiverWCO = Context.WorldContext;
-
-	//name is derived from WCO + lambda pointer address
-	FString FunctionPtr = FString::Printf(TEXT("%d"), (void*)&ReceivingLambda);
-	Listener.FunctionName = Listener.ReceiverWCO->GetName() + TEXT(".lambda.") + FunctionPtr;
-
-	AddListener(Context.Domain, Context.Event, Listener);
+	return CopyPinnedValue(Pinned.Property.Get(), Pinned.PropertyPtr, OutProperty, OutPtr);
+}
 
-	return Listener.FunctionName;
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, bool& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Bool(), &OutValue, OutVersion);
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(UStruct* Struct, void* StructPtr)> ReceivingLambda)
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, int32& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Int(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, float& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Float(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, double& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Double(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, FString& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Str(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, FName& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Name(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinned(const FString& Domain, const FString& Event, UObject*& OutValue, uint32* OutVersion /*= nullptr*/)
+{
+	return TryGetPinned(Domain, Event, FGESPropertyPool::Object(), &OutValue, OutVersion);
+}
+
+bool FGESHandler::TryGetPinnedStruct(const FString& Domain, const FString& Event, UScriptStruct* Struct, void* OutStructPtr, uint32* OutVersion /*= nullptr*/)
+{
+	FGESWildcardProperty Pinned;
+	if (!Struct || !OutStructPtr || !TryGetPinned(Domain, Event, Pinned, OutVersion))
+	{
+		return false;
+	}
+
+	FStructProperty* StructProperty = CastField<FStructProperty>(Pinned.Property.Get());
+	if (!StructProperty || StructProperty->Struct != Struct || !Pinned.PropertyPtr)
+	{
+		return false;
+	}
+	Struct->CopyScriptStruct(OutStructPtr, Pinned.PropertyPtr);
+	return true;
+}
+
+void FGESHandler::UnpinEvent(const FString& Domain, const FString& EventName)
+{
+	FString KeyString = Key(Domain, EventName);
+	if (EventMap.Contains(KeyString))
+	{
+		FGESEvent& Event = EventMap[KeyString];
+		if (Event.bPinned)
+		{
+			Event.PinnedVersion = ++NextPinnedVersion;
+		}
+		Event.bPinned = false;
+		QueueCompaction(KeyString, Event);
+		//Event.PinnedData.Property->RemoveFromRoot();
+		//Event.PinnedData.PropertyData.Empty();  not sure if safe to delete instead of rebuilding on next pin
+	}
+}
+
+void FGESHandler::AddPollReader(const FString& Domain, const FString& EventName)
+{
+	LLM_SCOPE_BYTAG(GES);
+	FString KeyString = Key(Domain, EventName);
+
+	if (!EventMap.Contains(KeyString))
+	{
+		CreateEvent(Domain, EventName);
+	}
+
+	FGESEvent& Event = EventMap[KeyString];
+	Event.PollSlot.ReaderCount++;
+
+	//first reader of a pinned event can poll the pinned value right away
+	if (Event.PollSlot.ReaderCount == 1 && Event.bPinned && Event.PinnedData.Property)
+	{
+		Event.PollSlot.Store(Event.PinnedData.Property, Event.PinnedData.PropertyPtr, Event.PinnedData.bHandlePropertyDeletion);
+	}
+}
+
+void FGESHandler::RemovePollReader(const FString& Domain, const FString& EventName)
+{
+	FString KeyString = Key(Domain, EventName);
+	FGESEvent* Event = EventMap.Find(KeyString);
+	if (!Event || Event->PollSlot.ReaderCount <= 0)
+	{
+		return;
+	}
+
+	Event->PollSlot.ReaderCount--;
+	if (Event->PollSlot.ReaderCount == 0)
+	{
+		//nobody polls anymore, release the value
+		Event->PollSlot.Reset();
+		QueueCompaction(KeyString, *Event);
+	}
+}
+
+bool FGESHandler::GetPolledValue(const FString& Domain, const FString& EventName, FGESWildcardProperty& OutProperty)
+{
+	FGESEvent* Event = EventMap.Find(Key(Domain, EventName));
+	if (!Event || !Event->PollSlot.bHasValue)
+	{
+		return false;
+	}
+	OutProperty.Property = Event->PollSlot.Property;
+	OutProperty.PropertyPtr = Event->PollSlot.Buffer.GetData();
+	return true;
+}
+
+void FGESHandler::AddListeners(const TArray<FGESListenerBind>& Binds)
+{
+	LLM_SCOPE_BYTAG(GES);
+	//size the indices once instead of growing per listener
+	EventMap.Reserve(EventMap.Num() + Binds.Num());
+
+	UObject* LastReceiver = nullptr;
+	for (const FGESListenerBind& Bind : Binds)
+	{
+		UObject* Receiver = Bind.Listener.ReceiverWCO.Get();
+		if (Receiver && Receiver != LastReceiver)
+		{
+			TArray<FGESReceiverBind>& ReceiverArray = ReceiverMap.FindOrAdd(Receiver);
+			ReceiverArray.Reserve(ReceiverArray.Num() + Binds.Num());
+			LastReceiver = Receiver;
+		}
+	}
+
+	for (const FGESListenerBind& Bind : Binds)
+	{
+		AddListener(Bind.Domain, Bind.Event, Bind.Listener);
+	}
+}
+
+void FGESHandler::AddListener(const FString& Domain, const FString& EventName, const FGESEventListener& Listener)
+{
+	AddListenerToKey(Domain, EventName, Key(Domain, EventName), Listener);
+}
+
+void FGESHandler::AddListener(const FGESEventHandle& Handle, const FGESEventListener& Listener)
+{
+	AddListenerToKey(Handle.Domain, Handle.Event, Handle.Key, Listener);
+}
+
+void FGESHandler::AddListenerToKey(const FString& Domain, const FString& EventName, const FString& KeyString, const FGESEventListener& Listener)
+{
+	LLM_SCOPE_BYTAG(GES);
+
+	//Create event if not already created
+	if (!EventMap.Contains(KeyString))
+	{
+		CreateEvent(Domain, EventName);
+	}
+
+	//Check passed listener validity
+	if (Listener.IsValidListener())
+	{
+		//Actually add this valid listener to map
+		FGESEvent& Event = EventMap[KeyString];
+		Event.Listeners.Add(Listener);
+
+		//positioned listeners are also kept in the event's grid for located emits
+		if (Listener.GetPositionSource())
+		{
+			if (!Event.SpatialIndex.IsValid())
+			{
+				Event.SpatialIndex = MakeShared<FGESSpatialIndex, ESPMode::NotThreadSafe>(CVarGESSpatialCellSize.GetValueOnGameThread());
+			}
+			Event.SpatialIndex->Add(Listener);
+		}
+
+		//receiver index only keeps interned names, the receiver is the map key
+		FGESReceiverBind ReceiverBind;
+		ReceiverBind.EventKey = FName(*KeyString);
+		ReceiverBind.FunctionName = Listener.FunctionName;
+		ReceiverMap.FindOrAdd(Listener.ReceiverWCO.Get()).Add(ReceiverBind);
+
+		//if it's pinned re-emit it immediately to this listener
+		if (Event.bPinned) 
+		{
+			//target the stored entry so state set during delivery (e.g. bLoggedParamMismatch) sticks, the snapshot
+			//keeps it alive while callbacks change the listeners
+			const FGESListenerArray::FSnapshot Snapshot = Event.Listeners.Pin();
+
+			FGESPropertyEmitContext EmitData;
+			
+			EmitData.Domain = Domain;
+			EmitData.Event = EventName;
+
+			EmitData.Property = Event.PinnedData.Property;
+			EmitData.PropertyPtr = Event.PinnedData.PropertyPtr;
+			EmitData.bPinned = Event.bPinned;
+			EmitData.SpecificTarget = &Snapshot->Last();	//this immediate call should only be calling our listener
+			EmitData.WorldContext = Event.WorldContext;
+			
+			//did we fail to emit?
+			if (!EmitPropertyEvent(EmitData))
+			{
+				//did the event get removed due to being stale? The listener may still be valid so re-run this add listener loop
+				if (!HasEvent(Domain, EventName))
+				{
+					AddListenerToKey(Domain, EventName, KeyString, Listener);
+				}
+			}
+		}
+	}
+	else
+	{
+		//NB: validity can be violated due to delegate and lambda too
+		//TODO: add warnings in case of invalid delegate/lambda function binds
+
+		//Not valid, emit warnings
+		if (Listener.ReceiverWCO->IsValidLowLevelFast())
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddListener Warning: \n%s does not have the function '%s'. Attempted to bind to GESEvent %s.%s"), *Listener.ReceiverWCO->GetFullName(), *Listener.FunctionName.ToString(), *Domain, *EventName);
+		}
+		else
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddListener: (invalid object) does not have the function '%s'. Attempted to bind to GESEvent %s.%s"), *Listener.FunctionName.ToString(), *Domain, *EventName);
+		}
+	}
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext Context, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda)
+{
+	if (Context.WorldContext == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddLambdaListener No valid world context provided. Not added."));
+		return TEXT("Invalid");
+	}
+	FGESEventListener Listener;
+	Listener.BindLambda(ReceivingLambda);
+	Listener.ReceiverWCO = Context.WorldContext;
+	Listener.DeliveryPhase = Context.DeliveryPhase;
+	Listener.SetPositionSource(Context.PositionSource);
+
+	//WCO name + counter, kept as the FName number so every lambda shares one name entry
+	Listener.FunctionName = FName(*(Listener.ReceiverWCO->GetName() + TEXT(".lambda")), ++NextLambdaId);
+
+	AddListener(Context.Domain, Context.Event, Listener);
+
+	return Listener.FunctionName.ToString();
+}
+
+FString FGESHandler::AddOneShotLambdaListener(FGESEventContext Context, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda)
+{
+	if (Context.WorldContext == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddOneShotLambdaListener No valid world context provided. Not added."));
+		return TEXT("Invalid");
+	}
+
+	//pinned, deliver right away and skip the listener entirely. Stale pinned events take the regular path below which cleans them up.
+	FGESEvent* Event = EventMap.Find(Key(Context.Domain, Context.Event));
+	if (Event && Event->bPinned && Event->WorldContext && Event->WorldContext->IsValidLowLevel())
+	{
+		FGESWildcardProperty Wrapper;
+		Wrapper.Property = Event->PinnedData.Property;
+		Wrapper.PropertyPtr = Event->PinnedData.PropertyPtr;
+		ReceivingLambda(Wrapper);
+		return FString();
+	}
+
+	FGESEventListener Listener;
+	Listener.BindLambda(ReceivingLambda);
+	Listener.MakeOneShot();
+	Listener.ReceiverWCO = Context.WorldContext;
+	Listener.DeliveryPhase = Context.DeliveryPhase;
+	Listener.SetPositionSource(Context.PositionSource);
+
+	//one-shots are typically re-added from the same call site, a counter keeps the names unique
+	Listener.FunctionName = FName(*(Listener.ReceiverWCO->GetName() + TEXT(".once")), ++NextLambdaId);
+
+	AddListener(Context.Domain, Context.Event, Listener);
+
+	return Listener.FunctionName.ToString();
+}
+
+TFuture<bool> FGESHandler::WaitForEvent(FGESEventContext Context, TFunction<void(const FGESWildcardProperty&)> OnEvent, float Timeout)
+{
+	TSharedPtr<FGESWaitState> State = MakeShared<FGESWaitState>();
+	TFuture<bool> Future = State->Promise.GetFuture();
+
+	if (Context.WorldContext == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::WaitForEvent No valid world context provided."));
+		State->bCompleted = true;
+		State->Promise.SetValue(false);
+		return Future;
+	}
+
+	FString LambdaName = AddOneShotLambdaListener(Context, [State, OnEvent](const FGESWildcardProperty& Data)
+	{
+		if (State->bCompleted)
+		{
+			return;
+		}
+		State->bCompleted = true;
+		if (OnEvent)
+		{
+			OnEvent(Data);
+		}
+		State->Promise.SetValue(true);
+	});
+
+	if (!State->bCompleted && Timeout > 0.f)
+	{
+		FGESEventListenerWithContext WaitListener;
+		WaitListener.Domain = Context.Domain;
+		WaitListener.Event = Context.Event;
+		WaitListener.Listener.ReceiverWCO = Context.WorldContext;
+		WaitListener.Listener.FunctionName = FName(*LambdaName);
+
+		AddTimeout(Timeout, [this, State, WaitListener]()
+		{
+			if (State->bCompleted)
+			{
+				return;
+			}
+			State->bCompleted = true;
+			RemoveListener(WaitListener.Domain, WaitListener.Event, FGESEventListener(WaitListener.Listener));
+			State->Promise.SetValue(false);
+		});
+	}
+	return Future;
+}
+
+void FGESHandler::AddTimeout(double Delay, TFunction<void()> OnExpire)
+{
+	LLM_SCOPE_BYTAG(GES);
+
+	//created on first use and released once idle, most buses (e.g. actor scopes) never time anything out
+	if (!TimeoutWheel.IsValid())
+	{
+		TimeoutWheel = MakeUnique<FGESTimerWheel>();
+	}
+	TimeoutWheel->Add(Delay, FPlatformTime::Seconds(), MoveTemp(OnExpire));
+
+	if (!TimeoutTickerHandle.IsValid())
+	{
+		TimeoutTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGESHandler::TickTimeouts));
+	}
+}
+
+bool FGESHandler::TickTimeouts(float DeltaTime)
+{
+	TimeoutWheel->Advance(FPlatformTime::Seconds());
+
+	if (TimeoutWheel->Num() == 0)
+	{
+		TimeoutWheel.Reset();
+
+		//returning false removes the ticker
+		TimeoutTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FGESHandler::IsEventUnused(const FGESEvent& Event)
+{
+	return !Event.bPinned && Event.Listeners.Num() == 0 && Event.PollSlot.ReaderCount == 0;
+}
+
+void FGESHandler::QueueCompaction(const FString& KeyString, const FGESEvent& Event)
+{
+	if (!IsEventUnused(Event) || CVarGESCompactBudget.GetValueOnGameThread() <= 0)
+	{
+		return;
+	}
+
+	CompactionQueue.Add(KeyString);
+
+	//events may be in the middle of a dispatch here, delete them from the ticker instead
+	if (!CompactionTickerHandle.IsValid())
+	{
+		CompactionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGESHandler::TickCompaction));
+	}
+}
+
+bool FGESHandler::TickCompaction(float DeltaTime)
+{
+	int32 Budget = CVarGESCompactBudget.GetValueOnGameThread();
+
+	//a large backlog (e.g. a level's worth of receivers unbinding) is worked off faster than a trickle
+	Budget = FMath::Max(Budget, CompactionQueue.Num() / 8);
+
+	for (TSet<FString>::TIterator It(CompactionQueue); It && Budget > 0; ++It, --Budget)
+	{
+		const FGESEvent* Event = EventMap.Find(*It);
+
+		//rebound, re-pinned or polled again since it was queued, keep it
+		if (Event && IsEventUnused(*Event))
+		{
+			for (const TPair<UWorld*, AGESWorldListenerActor*>& Pair : WorldMap)
+			{
+				if (IsValid(Pair.Value))
+				{
+					Pair.Value->WorldEvents.Remove(*It);
+				}
+			}
+			DeleteEvent(*It);
+		}
+		It.RemoveCurrent();
+	}
+
+	if (CompactionQueue.Num() == 0)
+	{
+		//returning false removes the ticker
+		CompactionQueue.Compact();
+		CompactionTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+int32 FGESHandler::EmitRequest(const FGESEmitContext& EmitData, FProperty* Property, const void* PropertyPtr, TFunction<void(bool bReplied, const FGESWildcardProperty& Reply)> OnReply, float Timeout)
+{
+	LLM_SCOPE_BYTAG(GES);
+	int32 Index;
+	if (FreeRequestSlots.Num() > 0)
+	{
+		Index = FreeRequestSlots.Pop(false);
+	}
+	else if (RequestTable.Num() <= 0xFFFF)
+	{
+		Index = RequestTable.AddDefaulted();
+	}
+	else
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitRequest too many pending requests, %s.%s not sent."), *EmitData.Domain, *EmitData.Event);
+		return -1;
+	}
+
+	FGESPendingRequest& Request = RequestTable[Index];
+	Request.Generation = NextRequestGeneration;
+	NextRequestGeneration = (NextRequestGeneration % 0x7FFF) + 1;
+	Request.bActive = true;
+	Request.OnReply = MoveTemp(OnReply);
+
+	const int32 RequestId = ((int32)Request.Generation << 16) | Index;
+
+	if (Timeout > 0.f)
+	{
+		AddTimeout(Timeout, [this, RequestId]()
+		{
+			CompleteRequest(RequestId, false, FGESWildcardProperty());
+		});
+	}
+
+	FGESPropertyEmitContext PropData(EmitData);
+	PropData.bPinned = false;	//a stored request would be answered again by every late listener
+	PropData.Property = Property;
+	PropData.PropertyPtr = const_cast<void*>(PropertyPtr);
+
+	//listeners can reply synchronously or keep the id, nested requests restore the outer id
+	const int32 PreviousRequestId = CurrentRequestId;
+	CurrentRequestId = RequestId;
+	const bool bDidEmit = EmitPropertyEvent(PropData);
+	CurrentRequestId = PreviousRequestId;
+
+	//invalid context or unsupported data, nobody can reply
+	if (!bDidEmit)
+	{
+		CancelRequest(RequestId);
+		return -1;
+	}
+	return RequestId;
+}
+
+int32 FGESHandler::GetCurrentRequestId() const
+{
+	return CurrentRequestId;
+}
+
+int32 FGESHandler::FindRequestIndex(int32 RequestId) const
+{
+	const int32 Index = RequestId & 0xFFFF;
+	const uint16 Generation = (uint16)((RequestId >> 16) & 0x7FFF);
+
+	if (RequestId < 0 || !RequestTable.IsValidIndex(Index) || 
+		!RequestTable[Index].bActive || RequestTable[Index].Generation != Generation)
+	{
+		return INDEX_NONE;
+	}
+	return Index;
+}
+
+bool FGESHandler::CompleteRequest(int32 RequestId, bool bReplied, const FGESWildcardProperty& ReplyData)
+{
+	const int32 Index = FindRequestIndex(RequestId);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	//release the slot before the callback, it may send the next request
+	FGESPendingRequest& Request = RequestTable[Index];
+	TFunction<void(bool, const FGESWildcardProperty&)> OnReply = MoveTemp(Request.OnReply);
+	Request.OnReply = nullptr;
+	Request.bActive = false;
+	FreeRequestSlots.Add(Index);
+
+	if (OnReply)
+	{
+		OnReply(bReplied, ReplyData);
+	}
+	return true;
+}
+
+bool FGESHandler::Reply(int32 RequestId, FProperty* Property, const void* PropertyPtr)
+{
+	FGESWildcardProperty ReplyData;
+	ReplyData.Property = Property;
+	ReplyData.PropertyPtr = const_cast<void*>(PropertyPtr);
+	return CompleteRequest(RequestId, true, ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId)
+{
+	return Reply(RequestId, nullptr, nullptr);
+}
+
+bool FGESHandler::Reply(int32 RequestId, const FString& ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Str(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, UObject* ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Object(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, float ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Float(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, int32 ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Int(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, bool ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Bool(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, const FName& ReplyData)
+{
+	return Reply(RequestId, FGESPropertyPool::Name(), &ReplyData);
+}
+
+bool FGESHandler::Reply(int32 RequestId, const GES_RAW_TEXT ReplyData)
+{
+	return Reply(RequestId, FString(ReplyData));
+}
+
+void FGESHandler::CancelRequest(int32 RequestId)
+{
+	const int32 Index = FindRequestIndex(RequestId);
+	if (Index != INDEX_NONE)
+	{
+		RequestTable[Index].OnReply = nullptr;
+		RequestTable[Index].bActive = false;
+		FreeRequestSlots.Add(Index);
+	}
+}
+
+int32 FGESHandler::AddJoin(UObject* WorldContext, const FGESJoinDefinition& Definition, TFunction<void()> OnComplete)
+{
+	LLM_SCOPE_BYTAG(GES);
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddJoin No valid world context provided. Not added."));
+		return -1;
+	}
+	if (Definition.Inputs.Num() == 0 || Definition.Inputs.Num() > 64)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddJoin joins take 1 to 64 inputs, got %d. Not added."), Definition.Inputs.Num());
+		return -1;
+	}
+
+	//inputs may live on other buses, actor scoped ones on the scope of WorldContext
+	TArray<TSharedPtr<FGESHandler>, TInlineAllocator<8>> InputHandlers;
+	FString JoinKey = FString::Printf(TEXT("%p|%d|%d|%s|"), World, (int32)Definition.Mode, Definition.bPinOutput, *Key(Definition.Output.Domain, Definition.Output.Event));
+	for (const FGESDomainEvent& Input : Definition.Inputs)
+	{
+		InputHandlers.Add(ForDomain(Input.Domain, WorldContext));
+		JoinKey += FString::Printf(TEXT("%p:"), InputHandlers.Last().Get()) + Key(Input.Domain, Input.Event) + TEXT(",");
+	}
+
+	//handles and join ids share one counter
+	const int32 Handle = NextJoinId++;
+
+	//keys embed the world address, a join of an earlier world at the same address is never reused
+	int32* ExistingJoinId = JoinIdsByKey.Find(JoinKey);
+	if (ExistingJoinId && !Joins[*ExistingJoinId].World.IsValid())
+	{
+		DropJoin(*ExistingJoinId);
+		ExistingJoinId = nullptr;
+	}
+	if (ExistingJoinId)
+	{
+		FGESJoin& Join = Joins[*ExistingJoinId];
+		Join.Callbacks.Add(Handle, OnComplete);
+		JoinHandles.Add(Handle, *ExistingJoinId);
+
+		if (Join.bCompleted && OnComplete)
+		{
+			OnComplete();
+		}
+		return Handle;
+	}
+
+	//joins end with their world
+	WorldListenerFor(World);
+
+	const int32 JoinId = NextJoinId++;
+	FGESJoin& Join = Joins.Add(JoinId);
+	Join.Definition = Definition;
+	Join.Key = JoinKey;
+	Join.World = World;
+	Join.Context = WorldContext;
+	Join.CompleteMask = (Definition.Inputs.Num() == 64) ? MAX_uint64 : ((1ull << Definition.Inputs.Num()) - 1);
+	Join.Callbacks.Add(Handle, OnComplete);
+	JoinIdsByKey.Add(JoinKey, JoinId);
+	JoinHandles.Add(Handle, JoinId);
+
+	//pinned inputs are delivered while adding, completion is checked once all inputs are bound
+	Join.bArming = true;
+	TWeakPtr<FGESHandler> WeakThis = AsShared();
+	for (int32 InputIndex = 0; InputIndex < Definition.Inputs.Num(); InputIndex++)
+	{
+		//input buses may outlive this one (scoped joins)
+		FGESEventListener Listener;
+		Listener.BindLambda([WeakThis, JoinId, InputIndex](const FGESWildcardProperty& Data)
+		{
+			TSharedPtr<FGESHandler> Handler = WeakThis.Pin();
+			if (Handler.IsValid())
+			{
+				Handler->OnJoinInput(JoinId, InputIndex);
+			}
+		});
+		Listener.ReceiverWCO = World;
+		Listener.FunctionName = JoinListenerName(JoinId, InputIndex);
+
+		const FGESDomainEvent& Input = Definition.Inputs[InputIndex];
+		InputHandlers[InputIndex]->AddListener(Input.Domain, Input.Event, Listener);
+	}
+
+	//adding listeners may have grown the map
+	FGESJoin& ArmedJoin = Joins[JoinId];
+	ArmedJoin.bArming = false;
+
+	if (IsJoinSatisfied(ArmedJoin))
+	{
+		CompleteJoin(JoinId);
+	}
+	return Handle;
+}
+
+void FGESHandler::OnJoinInput(int32 JoinId, int32 InputIndex)
+{
+	FGESJoin* Join = Joins.Find(JoinId);
+	if (!Join || Join->bCompleted)
+	{
+		return;
+	}
+
+	const uint64 Bit = 1ull << InputIndex;
+	if (Join->Definition.Mode == EGESJoinMode::Sequence && !Join->bArming)
+	{
+		//only the first missing input advances a sequence
+		const uint64 NextBit = ~Join->ReceivedMask & (Join->ReceivedMask + 1);
+		if (Bit != NextBit)
+		{
+			return;
+		}
+	}
+	Join->ReceivedMask |= Bit;
+
+	if (Join->bArming)
+	{
+		return;
+	}
+
+	if (IsJoinSatisfied(*Join))
+	{
+		CompleteJoin(JoinId);
+	}
+}
+
+void FGESHandler::CompleteJoin(int32 JoinId)
+{
+	FGESJoin& Join = Joins[JoinId];
+	Join.bCompleted = true;
+	RemoveJoinListeners(Join, JoinId);
+
+	//copy out, the output emit and callbacks may add or remove joins
+	FGESEmitContext Output;
+	Output.Domain = Join.Definition.Output.Domain;
+	Output.Event = Join.Definition.Output.Event;
+	Output.bPinned = Join.Definition.bPinOutput;
+	Output.WorldContext = Join.World.Get();
+	UObject* JoinContext = Join.Context.Get();
+
+	TArray<TFunction<void()>> Callbacks;
+	for (const TPair<int32, TFunction<void()>>& Pair : Join.Callbacks)
+	{
+		if (Pair.Value)
+		{
+			Callbacks.Add(Pair.Value);
+		}
+	}
+
+	if (!Output.Event.IsEmpty() && Output.WorldContext)
+	{
+		//actor scoped outputs are dropped once the join's context is gone
+		TSharedPtr<FGESHandler> OutputHandler = JoinContext ? ForDomain(Output.Domain, JoinContext) : FindForDomain(Output.Domain, nullptr);
+		if (OutputHandler.IsValid())
+		{
+			OutputHandler->EmitEvent(Output);
+		}
+	}
+	for (TFunction<void()>& Callback : Callbacks)
+	{
+		Callback();
+	}
+}
+
+FName FGESHandler::JoinListenerName(int32 JoinId, int32 InputIndex)
+{
+	return FName(*FString::Printf(TEXT("ges.join.%d"), JoinId), InputIndex + 1);
+}
+
+void FGESHandler::RemoveJoinListeners(const FGESJoin& Join, int32 JoinId, bool bIncludeScopedInputs /*= true*/)
+{
+	for (int32 InputIndex = 0; InputIndex < Join.Definition.Inputs.Num(); InputIndex++)
+	{
+		if (!bIncludeScopedInputs && IsActorScopeDomain(Join.Definition.Inputs[InputIndex].Domain))
+		{
+			continue;
+		}
+		FGESMinimalEventListener Listener;
+		Listener.ReceiverWCO = Join.World;
+		Listener.FunctionName = JoinListenerName(JoinId, InputIndex);
+		const FGESDomainEvent& Input = Join.Definition.Inputs[InputIndex];
+		TSharedPtr<FGESHandler> InputHandler = FindForDomain(Input.Domain, Join.Context.Get());
+		if (InputHandler.IsValid())
+		{
+			InputHandler->RemoveListener(Input.Domain, Input.Event, FGESEventListener(Listener));
+		}
+	}
+}
+
+void FGESHandler::RemoveJoin(int32 JoinHandle)
+{
+	int32 JoinId;
+	if (!JoinHandles.RemoveAndCopyValue(JoinHandle, JoinId))
+	{
+		return;
+	}
+
+	FGESJoin* Join = Joins.Find(JoinId);
+	if (!Join)
+	{
+		return;
+	}
+
+	Join->Callbacks.Remove(JoinHandle);
+	if (Join->Callbacks.Num() > 0)
+	{
+		return;
+	}
+
+	//last consumer gone
+	DropJoin(JoinId);
+}
+
+void FGESHandler::DropJoin(int32 JoinId)
+{
+	FGESJoin* Join = Joins.Find(JoinId);
+	if (!Join)
+	{
+		return;
+	}
+	if (!Join->bCompleted)
+	{
+		RemoveJoinListeners(*Join, JoinId);
+	}
+	for (const TPair<int32, TFunction<void()>>& Pair : Join->Callbacks)
+	{
+		JoinHandles.Remove(Pair.Key);
+	}
+	JoinIdsByKey.Remove(Join->Key);
+	Joins.Remove(JoinId);
+}
+
+void FGESHandler::RemoveWorldJoins(UWorld* World)
+{
+	TArray<int32> WorldJoinIds;
+	for (const TPair<int32, FGESJoin>& Pair : Joins)
+	{
+		if (!Pair.Value.World.IsValid() || Pair.Value.World.Get() == World)
+		{
+			WorldJoinIds.Add(Pair.Key);
+		}
+	}
+	for (int32 JoinId : WorldJoinIds)
+	{
+		DropJoin(JoinId);
+	}
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(UStruct* Struct, void* StructPtr)> ReceivingLambda)
+{
+	return AddLambdaListener(BindInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FStructProperty* StructProperty = CastField<FStructProperty>(Data.Property.Get());
+
+			if (!StructProperty)
+			{
+				UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddLambdaListener callback: Expected a property structure, received %s; Receive skipped."), *Data.Property->GetName());
+				return;
+			}
+
+			ReceivingLambda(StructProperty->Struct, Data.PropertyPtr);
+		});
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(const FString&)> ReceivingLambda)
+{
+	return AddLambdaListener(BindInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FString Value;
+			UGlobalEventSystemBPLibrary::Conv_PropToStringRef(Data, Value);
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(UObject*)> ReceivingLambda)
+{
+	return AddLambdaListener(BindInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			UObject* Value = 0;
+			UGlobalEventSystemBPLibrary::Conv_PropToObject(Data, Value);
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(float)> ReceivingLambda)
+{
+	return AddLambdaListener(BindInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			float Value = 0;
+			UGlobalEventSystemBPLibrary::Conv_PropToFloat(Data, Value);
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(const FName&)> ReceivingLambda)
+{
+	return AddLambdaListener(BindInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FName Value;
+			UGlobalEventSystemBPLibrary::Conv_PropToName(Data, Value);
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(void)> ReceivingLambda)
 {
 	return AddLambdaListener(BindInfo,
 		[ReceivingLambda](const FGESWildcardProperty& Data)
 		{
-			FStructProperty* StructProperty = CastField<FStructProperty>(Data.Property.Get());
+			ReceivingLambda();
+		});
+}
+
+FString FGESHandler::AddLambdaListenerInt(FGESEventContext EventInfo, TFunction<void(int32)> ReceivingLambda)
+{
+	return AddLambdaListener(EventInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			int32 Value = 0;
+			UGlobalEventSystemBPLibrary::Conv_PropToInt(Data, Value);
+
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListenerBool(FGESEventContext EventInfo, TFunction<void(bool)> ReceivingLambda)
+{
+	return AddLambdaListener(EventInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			bool Value = false;
+			UGlobalEventSystemBPLibrary::Conv_PropToBool(Data, Value);
+			ReceivingLambda(Value);
+		});
+}
+
+FString FGESHandler::AddLambdaListenerArray(FGESEventContext EventInfo, TFunction<void(const FArrayProperty*, const FScriptArrayHelper&)> ReceivingLambda)
+{
+	return AddLambdaListener(EventInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Data.Property.Get());
+			if (!ArrayProperty)
+			{
+				GES_EMIT_LOG(Warning, TEXT("FGESHandler::AddLambdaListenerArray callback: Expected an array property; Receive skipped."));
+				return;
+			}
+			FScriptArrayHelper ArrayHelper(ArrayProperty, Data.PropertyPtr);
+			ReceivingLambda(ArrayProperty, ArrayHelper);
+		});
+}
+
+FString FGESHandler::AddLambdaListenerMap(FGESEventContext EventInfo, TFunction<void(const FMapProperty*, const FScriptMapHelper&)> ReceivingLambda)
+{
+	return AddLambdaListener(EventInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FMapProperty* MapProperty = CastField<FMapProperty>(Data.Property.Get());
+			if (!MapProperty)
+			{
+				GES_EMIT_LOG(Warning, TEXT("FGESHandler::AddLambdaListenerMap callback: Expected a map property; Receive skipped."));
+				return;
+			}
+			FScriptMapHelper MapHelper(MapProperty, Data.PropertyPtr);
+			ReceivingLambda(MapProperty, MapHelper);
+		});
+}
+
+FString FGESHandler::AddLambdaListenerSet(FGESEventContext EventInfo, TFunction<void(const FSetProperty*, const FScriptSetHelper&)> ReceivingLambda)
+{
+	return AddLambdaListener(EventInfo,
+		[ReceivingLambda](const FGESWildcardProperty& Data)
+		{
+			FSetProperty* SetProperty = CastField<FSetProperty>(Data.Property.Get());
+			if (!SetProperty)
+			{
+				GES_EMIT_LOG(Warning, TEXT("FGESHandler::AddLambdaListenerSet callback: Expected a set property; Receive skipped."));
+				return;
+			}
+			FScriptSetHelper SetHelper(SetProperty, Data.PropertyPtr);
+			ReceivingLambda(SetProperty, SetHelper);
+		});
+}
+
+FString FGESHandler::AddLambdaListenerBatch(FGESEventContext EventInfo, TFunction<void(const FGESBatchView&)> ReceivingLambda)
+{
+	if (EventInfo.WorldContext == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::AddLambdaListenerBatch No valid world context provided. Not added."));
+		return TEXT("Invalid");
+	}
+	FGESEventListener Listener;
+	Listener.BindLambda([ReceivingLambda](const FGESWildcardProperty& Data)
+	{
+		//bReceivesBatch listeners are always handed a view, see EmitToListenerWithData and EmitBatchToListeners
+		ReceivingLambda(*(const FGESBatchView*)Data.PropertyPtr);
+	});
+	Listener.bReceivesBatch = true;
+	Listener.ReceiverWCO = EventInfo.WorldContext;
+	Listener.DeliveryPhase = EventInfo.DeliveryPhase;
+	Listener.SetPositionSource(EventInfo.PositionSource);
+	Listener.FunctionName = FName(*(Listener.ReceiverWCO->GetName() + TEXT(".batch")), ++NextLambdaId);
+
+	AddListener(EventInfo.Domain, EventInfo.Event, Listener);
+
+	return Listener.FunctionName.ToString();
+}
+
+void FGESHandler::RemoveListener(const FString& Domain, const FString& Event, const FGESEventListener& Listener)
+{
+	FString KeyString = Key(Domain, Event);
+	if (!EventMap.Contains(KeyString))
+	{
+		if (Options.bLogStaleRemovals)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESHandler::RemoveListener, tried to remove a listener from an event that doesn't exist (%s.%s). Ignored."), *Domain, *Event);
+		}
+		return;
+	}
+
+	//Remove from main listener map
+	FGESEvent& Event = EventMap[KeyString];
+	if (Event.Listeners.Remove(Listener) > 0)
+	{
+		if (Event.SpatialIndex.IsValid())
+		{
+			Event.SpatialIndex->Remove(Listener);
+		}
+		QueueCompaction(KeyString, Event);
+	}
+
+	//Remove matched entry in receiver map
+	TArray<FGESReceiverBind>* ReceiverArray = ReceiverMap.Find(Listener.ReceiverWCO.Get());
+	if (ReceiverArray)
+	{
+		FGESReceiverBind ReceiverBind;
+		ReceiverBind.EventKey = FName(*KeyString);
+		ReceiverBind.FunctionName = Listener.FunctionName;
+		ReceiverArray->RemoveSingleSwap(ReceiverBind, false);
+	}
+}
+
+bool FGESHandler::RemoveAllListenersForReceiver(UObject* ReceiverWCO, bool bWarnIfMissing /*= true*/)
+{
+	if (!ReceiverMap.Contains(ReceiverWCO))
+	{
+		if (bWarnIfMissing)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESHandler::RemoveAllListenersForReceiver, tried to remove listeners from an WCO that doesn't exist. Ignored."));
+		}
+		return false;
+	}
+
+	//Take the whole entry, no need to update it per removed listener
+	TArray<FGESReceiverBind> ReceiverArray;
+	ReceiverMap.RemoveAndCopyValue(ReceiverWCO, ReceiverArray);
+	
+	FGESEventListener Listener;
+	Listener.ReceiverWCO = ReceiverWCO;
+	for (const FGESReceiverBind& ReceiverBind : ReceiverArray)
+	{
+		const FString KeyString = ReceiverBind.EventKey.ToString();
+		FGESEvent* Event = EventMap.Find(KeyString);
+		if (Event)
+		{
+			Listener.FunctionName = ReceiverBind.FunctionName;
+			Event->Listeners.Remove(Listener);
+			if (Event->SpatialIndex.IsValid())
+			{
+				Event->SpatialIndex->Remove(Listener);
+			}
+			QueueCompaction(KeyString, *Event);
+		}
+	}
+	return true;
+}
+
+void FGESHandler::RemoveLambdaListener(FGESEventContext BindInfo, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda)
+{
+	UE_LOG(LogGES, Warning, TEXT("FGESHandler::RemoveLambdaListener lambdas can't be matched by value, remove %s.%s with the name returned by AddLambdaListener instead."), *BindInfo.Domain, *BindInfo.Event);
+}
+
+void FGESHandler::RemoveLambdaListener(FGESEventContext BindInfo, const FString& LambdaName)
+{
+	FGESEventListener Listener;
+	Listener.ReceiverWCO = BindInfo.WorldContext;
+	Listener.FunctionName = FName(*LambdaName);
+
+	RemoveListener(BindInfo.Domain, BindInfo.Event, Listener);
+}
+
+AGESWorldListenerActor* FGESHandler::WorldListenerFor(UWorld* World)
+{
+	AGESWorldListenerActor* ExistingListener = WorldMap.FindRef(World);
+	if (ExistingListener)
+	{
+		return ExistingListener;
+	}
+
+	//Attach a world listener to each unique world
+	AGESWorldListenerActor* WorldListener = World->SpawnActor<AGESWorldListenerActor>();
+	WorldListener->OnEndPlay = [this, WorldListener, World]
+	{
+		for (const FString& EventKey : WorldListener->WorldEvents)
+		{
+			DeleteEvent(EventKey);
+		}
+		WorldListener->WorldEvents.Empty();
+
+		//For now always clear receiver map if any world ends
+		ReceiverMap.Empty();
+
+		//scheduled emits end with their world
+		TUniquePtr<FGESWorldSchedule> WorldSchedule;
+		if (WorldSchedules.RemoveAndCopyValue(World, WorldSchedule))
+		{
+			for (const TPair<int32, TSharedPtr<FGESScheduledEmit>>& Pair : WorldSchedule->Emits)
+			{
+				ScheduledEmitWorlds.Remove(Pair.Key);
+			}
+		}
+		WorldListener->OnTick = nullptr;
+
+		//joins and their handles end with their world too
+		RemoveWorldJoins(World);
+
+		//unregisters the phase tick functions, queued deliveries are dropped
+		WorldPhases.Remove(World);
+
+		WorldMap.Remove(World);
+	};
+	WorldListener->OnTick = [this, World](float DeltaSeconds)
+	{
+		TickWorldSchedule(World, DeltaSeconds);
+	};
+	WorldMap.Add(World, WorldListener);
+	return WorldListener;
+}
+
+const FString& FGESHandler::EmitKey(const FGESPropertyEmitContext& EmitData, FString& KeyStorage)
+{
+	if (EmitData.EventKey)
+	{
+		return *EmitData.EventKey;
+	}
+	KeyStorage = Key(EmitData.Domain, EmitData.Event);
+	return KeyStorage;
+}
+
+FGESEvent* FGESHandler::BeginEmit(const FGESPropertyEmitContext& EmitData, const FString& KeyString, const FGESBatchView* Batch)
+{
+	LLM_SCOPE_BYTAG(GES);
+	if (EmitData.WorldContext == nullptr)
+	{
+		UE_LOG(LogGES, Error, TEXT("FGESHandler::BeginEmit: Emitted event has no world context!"));
+		return nullptr;
+	}
+
+	UWorld* World = EmitData.WorldContext->GetWorld();
+	if (!World->IsValidLowLevelFast())
+	{
+		UE_LOG(LogGES, Error, TEXT("FGESHandler::BeginEmit: Emitted event has no world!"));
+		return nullptr;
+	}
+
+	FGESEvent* FoundEvent = EventMap.Find(KeyString);
+
+	//replay of a queued emit for a later phase, pin, poll and observers already saw it
+	if (EmitData.DeliveryPhase != EGESDeliveryPhase::Immediate)
+	{
+		return FoundEvent;
+	}
+	if (!FoundEvent)
+	{
+		if (!EmitData.bPinned)
+		{
+			//nobody listens, polls or pinned this event, nothing to store. Observers still see the emit.
+			ObserveEmit(EmitData, Batch);
+			return nullptr;
+		}
+		CreateEvent(EmitData.Domain, EmitData.Event, false);
+		FoundEvent = EventMap.Find(KeyString);
+	}
+	FGESEvent& Event = *FoundEvent;
+	Event.WorldContext = EmitData.WorldContext;
+
+	//ensure this event is registered, scoped buses are freed with their actor instead
+	if (!bIsScoped)
+	{
+		WorldListenerFor(World)->WorldEvents.Add(KeyString);
+	}
+
+	//is there a property to pin?
+	if (EmitData.Property)
+	{
+		//Warn if we're trying to pin a new event without unpinning old one
+		if (Event.bPinned && EmitData.bPinned)
+		{
+			//cleanup if different
+			if (EmitData.Property != Event.PinnedData.Property ||
+				EmitData.PropertyPtr != Event.PinnedData.PropertyPtr)
+			{
+				Event.PinnedData.CleanupPinnedData();
+			}
+			
+			Event.PinnedData.bHandlePropertyDeletion = EmitData.bHandleAllocation;
+			Event.PinnedData.Property = EmitData.Property;
+
+			//only copy if ptrs are different or nullptr
+			if (EmitData.PropertyPtr != Event.PinnedData.PropertyPtr || 
+				Event.PinnedData.PropertyPtr == nullptr)
+			{
+				Event.PinnedData.PropertyPtr = EmitData.PropertyPtr;
+				Event.PinnedData.CopyPropertyToPinnedBuffer();
+			}
+		
+			//UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitToListenersWithData Emitted a pinned event to an already pinned event. Pinned data updated."));
+		}
+		if (!Event.bPinned && EmitData.bPinned)
+		{
+			Event.PinnedData.CleanupPinnedData();
+			Event.PinnedData.bHandlePropertyDeletion = EmitData.bHandleAllocation;
+			Event.PinnedData.Property = EmitData.Property;
+			Event.PinnedData.PropertyPtr = EmitData.PropertyPtr;
+			Event.PinnedData.CopyPropertyToPinnedBuffer();
+		}
+	}
+	//re-deliveries of pinned data to new listeners (SpecificTarget) don't change the value
+	if ((EmitData.bPinned || Event.bPinned) && !EmitData.SpecificTarget)
+	{
+		Event.PinnedVersion = ++NextPinnedVersion;
+	}
+	const bool bWasPinned = Event.bPinned;
+	Event.bPinned = EmitData.bPinned;
+	if (bWasPinned && !Event.bPinned)
+	{
+		QueueCompaction(KeyString, Event);
+	}
+
+	if (!EmitData.SpecificTarget && Event.PollSlot.ReaderCount > 0)
+	{
+		Event.PollSlot.Store(EmitData.Property, EmitData.PropertyPtr, EmitData.bHandleAllocation);
+	}
+
+	if (!EmitData.SpecificTarget)
+	{
+		ObserveEmit(EmitData, Batch);
+	}
+	return &Event;
+}
+
+void FGESHandler::ObserveEmit(const FGESPropertyEmitContext& EmitData, const FGESBatchView* Batch)
+{
+	if (!Batch)
+	{
+		Stats.Emits++;
+		if (OnEmit.IsBound())
+		{
+			OnEmit.Broadcast(EmitData);
+		}
+		return;
+	}
+
+	Stats.Emits += Batch->Num;
+	if (OnEmit.IsBound())
+	{
+		//observers (recorder, bridge) see a batch as the single emits it replaces
+		FGESPropertyEmitContext ElementData = EmitData;
+		for (int32 i = 0; i < Batch->Num; i++)
+		{
+			ElementData.PropertyPtr = (void*)Batch->Get(i);
+			OnEmit.Broadcast(ElementData);
+		}
+	}
+}
+
+void FGESHandler::EmitToListenersWithData(const FGESPropertyEmitContext& EmitData, TFunction<void(const FGESEventListener&)> DataFillCallback)
+{
+	FString KeyStorage;
+	const FString& KeyString = EmitKey(EmitData, KeyStorage);
+	FGESEvent* FoundEvent = BeginEmit(EmitData, KeyString);
+	if (!FoundEvent)
+	{
+		return;
+	}
+	FGESEvent& Event = *FoundEvent;
+
+	//stale listeners found while delivering, pointers into Snapshot, NearbyListeners or the specific target. All of
+	//them outlive RemoveStaleListeners below.
+	TArray<const FGESEventListener*, TInlineAllocator<4>> StaleListeners;
+
+	//later phases with listeners on this event, bit per EGESDeliveryPhase
+	uint32 DeferredPhases = 0;
+
+	//positioned listeners in range of a located emit, copied from the grid
+	TArray<FGESEventListener, TInlineAllocator<16>> NearbyListeners;
+
+	//only emit to this target
+	if (EmitData.SpecificTarget)
+	{
+		//the stored entry, its snapshot is held by the caller for the duration of the emit
+		const FGESEventListener& Listener = *EmitData.SpecificTarget;
+
+		//stale listener, remove it
+		if (!Listener.ReceiverWCO->IsValidLowLevelFast())
+		{
+			StaleListeners.Add(EmitData.SpecificTarget);
+		}
+		else
+		{
+			if (Listener.bIsOneShot)
+			{
+				Listener.MarkOneShotDelivered();
+				RemoveListener(EmitData.Domain, EmitData.Event, Listener);
+			}
+
+			//potential issue: this opt bypasses specialization via datafillcallback
+			EmitToListenerWithData(EmitData, Listener, DataFillCallback);
+			Stats.Deliveries++;
+		}
+	}
+	//emit to all targets
+	else
+	{
+		//callbacks may bind, unbind or emit, changes go to a new listener array and this snapshot stays as is
+		const FGESListenerArray::FSnapshot Snapshot = Event.Listeners.Pin();
+
+		auto DeliverTo = [&](const FGESEventListener& Listener)
+		{
+			//stale listener, remove it
+			if (!Listener.ReceiverWCO->IsValidLowLevelFast())
+			{
+				StaleListeners.Add(&Listener);
+			}
+			else if (Listener.DeliveryPhase != EmitData.DeliveryPhase)
+			{
+				//runs in its own phase, replays only reach listeners of that phase
+				if (EmitData.DeliveryPhase == EGESDeliveryPhase::Immediate)
+				{
+					DeferredPhases |= 1u << (uint32)Listener.DeliveryPhase;
+				}
+			}
+			else if (!Listener.IsOneShotDelivered())
+			{
+				if (Listener.bIsOneShot)
+				{
+					Listener.MarkOneShotDelivered();
+					RemoveListener(EmitData.Domain, EmitData.Event, Listener);
+				}
+
+				//potential issue: this opt bypasses specialization via datafillcallback
+				EmitToListenerWithData(EmitData, Listener, DataFillCallback);
+				Stats.Deliveries++;
+			}
+		};
+
+		//located emits take positioned listeners from the grid, only the cells in range are visited.
+		//Event isn't touched once delivery starts, callbacks may rehash the event map.
+		const bool bLocated = EmitData.bLocated && Event.SpatialIndex.IsValid();
+		const int32 IndexedListeners = bLocated ? Event.SpatialIndex->Num() : 0;
+		if (bLocated)
+		{
+			Event.SpatialIndex->Query(EmitData.Location, EmitData.Radius, NearbyListeners);
+			for (const FGESEventListener& Listener : NearbyListeners)
+			{
+				DeliverTo(Listener);
+			}
+		}
+
+		//listeners without a position source receive every emit, nothing left to walk if all of them have one
+		if (!bLocated || Snapshot->Num() > IndexedListeners)
+		{
+			for (const FGESEventListener& Listener : *Snapshot)
+			{
+				if (!bLocated || !Listener.HasPositionSource())
+				{
+					DeliverTo(Listener);
+				}
+			}
+		}
+	}
+
+	if (DeferredPhases)
+	{
+		QueueDeferredEmit(EmitData, DeferredPhases);
+	}
+
+	RemoveStaleListeners(KeyString, StaleListeners);
+}
+
+void FGESHandler::RemoveStaleListeners(const FString& KeyString, TArrayView<const FGESEventListener* const> StaleListeners)
+{
+	//Callbacks may have added or deleted events, look ours up again
+	FGESEvent* EventAfterDelivery = StaleListeners.Num() > 0 ? EventMap.Find(KeyString) : nullptr;
+	if (EventAfterDelivery)
+	{
+		for (const FGESEventListener* Listener : StaleListeners)
+		{
+			EventAfterDelivery->Listeners.Remove(*Listener);
+			if (EventAfterDelivery->SpatialIndex.IsValid())
+			{
+				EventAfterDelivery->SpatialIndex->Remove(*Listener);
+			}
+		}
+		QueueCompaction(KeyString, *EventAfterDelivery);
+		if (Options.bLogStaleRemovals)
+		{
+			GES_EMIT_LOG(Log, TEXT("FGESHandler::EmitEvent: auto-removed %d stale listeners."), StaleListeners.Num());
+		}
+	}
+}
 
-			if (!StructProperty)
+void FGESHandler::QueueDeferredEmit(const FGESPropertyEmitContext& EmitData, uint32 PhaseMask)
+{
+	LLM_SCOPE_BYTAG(GES);
+	UWorld* World = EmitData.WorldContext->GetWorld();
+	if (!World || !World->PersistentLevel)
+	{
+		return;
+	}
+
+	TUniquePtr<FGESWorldPhases>& Phases = WorldPhases.FindOrAdd(World);
+	if (!Phases.IsValid())
+	{
+		Phases = MakeUnique<FGESWorldPhases>();
+	}
+
+	FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(EmitData.Property);
+
+	for (int32 PhaseIndex = 0; PhaseIndex < FGESWorldPhases::NumDeferredPhases; PhaseIndex++)
+	{
+		const EGESDeliveryPhase Phase = (EGESDeliveryPhase)(PhaseIndex + 1);
+		if (!(PhaseMask & (1u << (uint32)Phase)))
+		{
+			continue;
+		}
+
+		//one copy per phase, shared by all listeners of that phase
+		FGESDeferredEmit& Deferred = Phases->Queues[PhaseIndex].AddDefaulted_GetRef();
+		Deferred.Context = EmitData;
+		Deferred.WorldContext = EmitData.WorldContext;
+		Deferred.Payload.Store(EmitData.Property, EmitData.PropertyPtr, EmitData.bHandleAllocation);
+		Deferred.bLocated = EmitData.bLocated;
+		Deferred.Location = EmitData.Location;
+		Deferred.Radius = EmitData.Radius;
+		if (ObjectProperty && EmitData.PropertyPtr)
+		{
+			Deferred.bObjectPayload = true;
+			Deferred.ObjectPayload = ObjectProperty->GetObjectPropertyValue(EmitData.PropertyPtr);
+		}
+
+		TUniquePtr<FGESPhaseTickFunction>& TickFunction = Phases->TickFunctions[PhaseIndex];
+		if (!TickFunction.IsValid())
+		{
+			//stays registered for the lifetime of the world, draining an empty queue is a no-op
+			TickFunction = MakeUnique<FGESPhaseTickFunction>();
+			TickFunction->Phase = Phase;
+			TickFunction->TickGroup = FGESWorldPhases::TickGroup(Phase);
+			TickFunction->EndTickGroup = TickFunction->TickGroup;
+			TickFunction->bCanEverTick = true;
+			TickFunction->bTickEvenWhenPaused = true;
+			TickFunction->OnTick = [this, World, Phase]()
 			{
-				UE_LOG(LogTemp, Warning, TEXT("FGESHandler::AddLambdaListener callback: Expected a property structure, received %s; Receive skipped."), *Data.Property->GetName());
-				return;
+				DeliverDeferredEmits(World, Phase);
+			};
+			TickFunction->RegisterTickFunction(World->PersistentLevel);
+		}
+	}
+}
+
+void FGESHandler::DeliverDeferredEmits(UWorld* World, EGESDeliveryPhase Phase)
+{
+	TUniquePtr<FGESWorldPhases>* Phases = WorldPhases.Find(World);
+	if (!Phases)
+	{
+		return;
+	}
+
+	//emits made by these listeners queue up for the next run of this phase
+	TArray<FGESDeferredEmit> Pending = MoveTemp((*Phases)->Queues[(int32)Phase - 1]);
+
+	for (FGESDeferredEmit& Deferred : Pending)
+	{
+		UObject* WorldContext = Deferred.WorldContext.Get();
+		if (!WorldContext)
+		{
+			continue;
+		}
+
+		FGESPropertyEmitContext EmitData(Deferred.Context);
+		EmitData.WorldContext = WorldContext;
+		EmitData.DeliveryPhase = Phase;
+		EmitData.bLocated = Deferred.bLocated;
+		EmitData.Location = Deferred.Location;
+		EmitData.Radius = Deferred.Radius;
+
+		if (Deferred.Payload.bHasValue)
+		{
+			if (Deferred.bObjectPayload)
+			{
+				CastField<FObjectPropertyBase>(Deferred.Payload.Property)->SetObjectPropertyValue(Deferred.Payload.Buffer.GetData(), Deferred.ObjectPayload.Get());
 			}
+			EmitData.Property = Deferred.Payload.Property;
+			EmitData.PropertyPtr = Deferred.Payload.Buffer.GetData();
+		}
+		EmitPropertyEvent(EmitData);
+	}
+}
 
-			ReceivingLambda(StructProperty->Struct, Data.PropertyPtr);
-		});
+bool FGESHandler::EmitToListenerWithData(const FGESPropertyEmitContext& EmitData, const FGESEventListener& Listener, TFunction<void(const FGESEventListener&)>& DataFillCallback)
+{
+	if (Listener.ReceiverWCO->IsValidLowLevelFast())
+	{
+		if (Listener.Kind() != EGESListenerKind::Function)
+		{
+			//Opt1) this listener is handled by lambda or wildcard event delegate
+			FGESWildcardProperty Wrapper;
+			Wrapper.Property = EmitData.Property;
+			Wrapper.PropertyPtr = EmitData.PropertyPtr;
+
+			//batch receivers get single emits as a batch of one
+			FGESBatchView Batch;
+			if (Listener.bReceivesBatch)
+			{
+				Batch.ElementProperty = EmitData.Property;
+				Batch.Elements = (const uint8*)EmitData.PropertyPtr;
+				Batch.Num = (EmitData.Property && EmitData.PropertyPtr) ? 1 : 0;
+				Wrapper.PropertyPtr = &Batch;
+			}
+
+			Listener.CallWildcard(Wrapper);
+			return true;
+		}
+
+		UFunction* BPFunction = Listener.ReceiverWCO->FindFunction(Listener.FunctionName);
+		if (BPFunction != nullptr)
+		{
+			//Opt3) listener is handled by function bind by name
+			DataFillCallback(Listener);
+			return true;
+		}
+		else
+		{
+			GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitEvent: Function not found '%s'"), *Listener.FunctionName.ToString());
+			return false;
+		}
+	}
+	return false;
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(const FString&)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, UStruct* Struct, void* StructPtr)
 {
-	return AddLambdaListener(BindInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	//skip the temporary struct property if nobody would see the emit
+	if (!WantsEmit(EmitData))
+	{
+		Stats.Emits++;
+		return;
+	}
+
+	bool bValidateStructs = Options.bValidateStructTypes;
+	FGESPropertyEmitContext PropData(EmitData);
+	UClass* Class = EmitData.WorldContext->GetClass();
+
+	FField* OldProperty = Class->ChildProperties;
+
+	FStructProperty* StructProperty = new FStructProperty(FFieldVariant(Class), TEXT("StructProperty"), RF_NoFlags);
+	StructProperty->Struct = (UScriptStruct*)Struct;
+	StructProperty->ElementSize = Struct->GetStructureSize();
+
+	//undo what we just did so it won't be traversed because of init
+	Class->ChildProperties = OldProperty;
+
+	//Listeners get a view of the emitter's struct, pinning makes a deep copy. The property is temporary,
+	//pinned data takes ownership of it and polls or deferred deliveries duplicate it.
+	PropData.Property = StructProperty;
+	PropData.PropertyPtr = StructPtr;
+	PropData.bHandleAllocation = true;
+
+	EmitToListenersWithData(PropData, [&PropData, &Struct, bValidateStructs](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FStructProperty::StaticClass(), PropData, Listener))
 		{
-			FString Value;
-			UGlobalEventSystemBPLibrary::Conv_PropToStringRef(Data, Value);
-			ReceivingLambda(Value);
-		});
+			if (bValidateStructs)
+			{
+				//For structs we can have different mismatching structs at this point check class types
+				FStructProperty* SubStructProperty = CastField<FStructProperty>(Listener.GetFirstParam());
+				if (SubStructProperty->Struct == Struct)
+				{
+					CallListenerFunction(Listener, PropData.PropertyPtr);
+				}
+#if GES_EMIT_LOGGING
+				else if (!Listener.bLoggedParamMismatch)
+				{
+					Listener.bLoggedParamMismatch = true;
+					UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s due to function not having a matching Struct type %s signature."),
+						*EmitEventLogString(PropData),
+						*ListenerLogString(Listener),
+						*Struct->GetName());
+				}
+#endif
+			}
+			//No validation, e.g. vector-> rotator fill is accepted
+			else
+			{
+				CallListenerFunction(Listener, PropData.PropertyPtr);
+			}
+		}
+	});
+
+
+	if (!EmitData.bPinned)
+	{
+		delete StructProperty;
+	}
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(UObject*)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const FString& ParamData)
 {
-	return AddLambdaListener(BindInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	FGESPropertyEmitContext PropData(EmitData);
+
+	//We have no property context, use the shared one
+	FStrProperty* StrProperty = FGESPropertyPool::Str();
+
+	//Listeners read the caller's string directly, pinning makes a deep copy
+	PropData.Property = StrProperty;
+	PropData.PropertyPtr = (void*)&ParamData;
+	EmitToListenersWithData(PropData, [&PropData](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FStrProperty::StaticClass(), PropData, Listener))
 		{
-			UObject* Value = 0;
-			UGlobalEventSystemBPLibrary::Conv_PropToObject(Data, Value);
-			ReceivingLambda(Value);
-		});
+			CallListenerFunction(Listener, PropData.PropertyPtr);// (void*)*MutableString); // (void*)&ParamData);
+		}
+	});
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(float)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, UObject* ParamData)
 {
-	return AddLambdaListener(BindInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	FGESPropertyEmitContext PropData(EmitData);
+
+	FObjectProperty* ObjectProperty = FGESPropertyPool::Object();
+
+	//wrapper required to avoid copied pointer to become the first function
+	FGESDynamicArg ParamWrapper;
+	ParamWrapper.Arg01 = ParamData;
+
+	PropData.Property = ObjectProperty;
+	PropData.PropertyPtr = (void*)&ParamWrapper;
+
+	EmitToListenersWithData(PropData, [&PropData, ParamWrapper](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FObjectProperty::StaticClass(), PropData, Listener) &&
+			FunctionAcceptsObject((UObject*)ParamWrapper.Arg01, PropData, Listener))
 		{
-			float Value = 0;
-			UGlobalEventSystemBPLibrary::Conv_PropToFloat(Data, Value);
-			ReceivingLambda(Value);
-		});
+			CallListenerFunction(Listener, (void*)&ParamWrapper);// PropData.PropertyPtr);
+		}
+	});
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(const FName&)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, float ParamData)
 {
-	return AddLambdaListener(BindInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	FGESPropertyEmitContext PropData(EmitData);
+
+	FGESWildcardProperty WrapperProperty;
+
+	FFloatProperty* FloatProperty = FGESPropertyPool::Float();
+
+	PropData.Property = FloatProperty;
+	PropData.PropertyPtr = &ParamData;// Buffer.GetData();
+	EmitToListenersWithData(PropData, [&PropData, &ParamData](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FNumericProperty::StaticClass(), PropData, Listener))
 		{
-			FName Value;
-			UGlobalEventSystemBPLibrary::Conv_PropToName(Data, Value);
-			ReceivingLambda(Value);
-		});
+			CallListenerFunction(Listener, PropData.PropertyPtr);// PropData.PropertyPtr);
+		}
+	});
 }
 
-FString FGESHandler::AddLambdaListener(FGESEventContext BindInfo, TFunction<void(void)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, int32 ParamData)
 {
-	return AddLambdaListener(BindInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	FGESPropertyEmitContext PropData(EmitData);
+
+	FIntProperty* IntProperty = FGESPropertyPool::Int();
+
+	PropData.Property = IntProperty;
+	PropData.PropertyPtr = &ParamData;
+	EmitToListenersWithData(PropData, [&PropData](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FNumericProperty::StaticClass(), PropData, Listener))
 		{
-			ReceivingLambda();
-		});
+			CallListenerFunction(Listener, PropData.PropertyPtr);
+		}
+	});
 }
 
-FString FGESHandler::AddLambdaListenerInt(FGESEventContext EventInfo, TFunction<void(int32)> ReceivingLambda)
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, bool ParamData)
 {
-	return AddLambdaListener(EventInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
+	FGESPropertyEmitContext PropData(EmitData);
+
+	FBoolProperty* BoolProperty = FGESPropertyPool::Bool();
+
+	PropData.Property = BoolProperty;
+	PropData.PropertyPtr = &ParamData;
+	EmitToListenersWithData(PropData, [&PropData](const FGESEventListener& Listener)
+	{
+		if (FunctionHasValidParams(FBoolProperty::StaticClass(), PropData, Listener))
 		{
-			int32 Value = 0;
-			UGlobalEventSystemBPLibrary::Conv_PropToInt(Data, Value);
+			CallListenerFunction(Listener, PropData.PropertyPtr);
+		}
+	});
+}
+
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const FName& ParamData)
+{
+	FGESPropertyEmitContext PropData(EmitData);
+
+	//We have no property context, use the shared one
+	FNameProperty* NameProperty = FGESPropertyPool::Name();
+
+	PropData.Property = NameProperty;
+	PropData.PropertyPtr = (void*)&ParamData;
+	EmitToListenersWithData(PropData, [&PropData, ParamData](const FGESEventListener& Listener)
+		{
+			if (FunctionHasValidParams(FStrProperty::StaticClass(), PropData, Listener))
+			{
+				CallListenerFunction(Listener, PropData.PropertyPtr);
+			}
+		});
+}
+
+bool FGESHandler::EmitEvent(const FGESEmitContext& EmitData)
+{
+	FGESPropertyEmitContext FullEmitData(EmitData);
+
+	//No param version
+	return EmitPropertyEvent(FullEmitData);
+}
+
+bool FGESHandler::EmitEvent(const FGESEventHandle& Handle, UObject* WorldContext, bool bPinned, FProperty* Property /*= nullptr*/, const void* PropertyPtr /*= nullptr*/)
+{
+	FGESPropertyEmitContext PropData;
+	PropData.Domain = Handle.Domain;
+	PropData.Event = Handle.Event;
+	PropData.EventKey = &Handle.Key;
+	PropData.WorldContext = WorldContext;
+	PropData.bPinned = bPinned;
+	PropData.Property = Property;
+	PropData.PropertyPtr = const_cast<void*>(PropertyPtr);
+
+	return EmitPropertyEvent(PropData);
+}
+
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, FProperty* Property, const void* PropertyPtr)
+{
+	FGESPropertyEmitContext PropData(EmitData);
+
+	//Property is owned by the caller's reflection data, nothing to clean up
+	PropData.Property = Property;
+	PropData.PropertyPtr = const_cast<void*>(PropertyPtr);
+
+	EmitPropertyEvent(PropData);
+}
 
-			ReceivingLambda(Value);
-		});
+void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const GES_RAW_TEXT RawStringMessage)
+{
+	EmitEvent(EmitData, FString(RawStringMessage));
 }
 
-FString FGESHandler::AddLambdaListenerBool(FGESEventContext EventInfo, TFunction<void(bool)> ReceivingLambda)
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, FProperty* ElementProperty, const void* Elements, int32 Num)
 {
-	return AddLambdaListener(EventInfo,
-		[ReceivingLambda](const FGESWildcardProperty& Data)
-		{
-			bool Value = false;
-			UGlobalEventSystemBPLibrary::Conv_PropToBool(Data, Value);
-			ReceivingLambda(Value);
-		});
+	FGESPropertyEmitContext PropData(EmitData);
+
+	FGESBatchView Batch;
+	Batch.ElementProperty = ElementProperty;
+	Batch.Elements = (const uint8*)Elements;
+	Batch.Num = Num;
+	EmitBatchToListeners(PropData, Batch, nullptr, nullptr);
 }
 
-void FGESHandler::RemoveListener(const FString& Domain, const FString& Event, const FGESEventListener& Listener)
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, FArrayProperty* ArrayProperty, const void* ArrayPtr)
 {
-	FString KeyString = Key(Domain, Event);
-	if (!EventMap.Contains(KeyString))
+	if (!ArrayProperty || !ArrayPtr)
 	{
-		if (Options.bLogStaleRemovals)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("FGESHandler::RemoveListener, tried to remove a listener from an event that doesn't exist (%s.%s). Ignored."), *Domain, *Event);
-		}
+		GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitBatch %s has no array to emit."), *EmitEventLogString(EmitData));
 		return;
 	}
+	FGESPropertyEmitContext PropData(EmitData);
+	FScriptArrayHelper Array(ArrayProperty, ArrayPtr);
 
-	//Remove from main listener map
-	EventMap[KeyString].Listeners.Remove(Listener);
-
-	//Remove matched entry in receiver map
-	if (ReceiverMap.Contains(Listener.ReceiverWCO.Get()))
-	{
-		FGESEventListenerWithContext ContextListener;
-		ContextListener.Domain = Domain;
-		ContextListener.Event = Event;
-		ContextListener.Listener.FunctionName = Listener.FunctionName;
-		ContextListener.Listener.ReceiverWCO = Listener.ReceiverWCO;
-		ReceiverMap[Listener.ReceiverWCO.Get()].Remove(ContextListener);
-	}
+	FGESBatchView Batch;
+	Batch.ElementProperty = ArrayProperty->Inner;
+	Batch.Elements = Array.Num() > 0 ? Array.GetRawPtr(0) : nullptr;
+	Batch.Num = Array.Num();
+	EmitBatchToListeners(PropData, Batch, ArrayProperty, ArrayPtr);
 }
 
-void FGESHandler::RemoveAllListenersForReceiver(UObject* ReceiverWCO)
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, UScriptStruct* Struct, const void* Structs, int32 Num)
 {
-	if (!ReceiverMap.Contains(ReceiverWCO))
+	//skip the temporary struct property if nobody would see the emit
+	if (!WantsEmit(EmitData))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FGESHandler::RemoveAllListenersForReceiver, tried to remove listeners from an WCO that doesn't exist. Ignored."));
+		Stats.Emits += Num;
+		return;
+	}
+	if (!Struct || !EmitData.WorldContext)
+	{
+		GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitBatch %s needs a struct type and a world context."), *EmitEventLogString(EmitData));
 		return;
 	}
 
-	//Copy array so we can loop over
-	TArray<FGESEventListenerWithContext> ReceiverArray = ReceiverMap[ReceiverWCO];
-	
-	for (FGESEventListenerWithContext& ListenContext: ReceiverArray)
+	FGESPropertyEmitContext PropData(EmitData);
+	UClass* Class = EmitData.WorldContext->GetClass();
+
+	FField* OldProperty = Class->ChildProperties;
+
+	FStructProperty* StructProperty = new FStructProperty(FFieldVariant(Class), TEXT("StructProperty"), RF_NoFlags);
+	StructProperty->Struct = Struct;
+	StructProperty->ElementSize = Struct->GetStructureSize();
+
+	//undo what we just did so it won't be traversed because of init
+	Class->ChildProperties = OldProperty;
+
+	//temporary property, see the single struct emit
+	PropData.bHandleAllocation = true;
+
+	FGESBatchView Batch;
+	Batch.ElementProperty = StructProperty;
+	Batch.Elements = (const uint8*)Structs;
+	Batch.Num = Num;
+	EmitBatchToListeners(PropData, Batch, nullptr, nullptr);
+
+	if (!EmitData.bPinned)
 	{
-		RemoveListener(ListenContext.Domain, ListenContext.Event, FGESEventListener(ListenContext.Listener));
+		delete StructProperty;
 	}
+}
 
-	ReceiverMap.Remove(ReceiverWCO);
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<float> Payloads)
+{
+	EmitBatch(EmitData, FGESPropertyPool::Float(), Payloads.GetData(), Payloads.Num());
 }
 
-void FGESHandler::RemoveLambdaListener(FGESEventContext BindInfo, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda)
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<int32> Payloads)
 {
-	FGESEventListener Listener;
-	Listener.bIsBoundToLambda = true;
-	Listener.LambdaFunction = ReceivingLambda;
-	Listener.ReceiverWCO = BindInfo.WorldContext;
+	EmitBatch(EmitData, FGESPropertyPool::Int(), Payloads.GetData(), Payloads.Num());
+}
 
-	FString FunctionPtr = FString::Printf(TEXT("%d"), (void*)&ReceivingLambda);
-	Listener.FunctionName = Listener.ReceiverWCO->GetName() + TEXT(".lambda.") + FunctionPtr;
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<bool> Payloads)
+{
+	EmitBatch(EmitData, FGESPropertyPool::Bool(), Payloads.GetData(), Payloads.Num());
+}
 
-	RemoveListener(BindInfo.Domain, BindInfo.Event, Listener);
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<FString> Payloads)
+{
+	EmitBatch(EmitData, FGESPropertyPool::Str(), Payloads.GetData(), Payloads.Num());
 }
 
-void FGESHandler::RemoveLambdaListener(FGESEventContext BindInfo, const FString& LambdaName)
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<FName> Payloads)
 {
-	FGESEventListener Listener;
-	Listener.bIsBoundToLambda = true;
-	Listener.ReceiverWCO = BindInfo.WorldContext;
-	Listener.FunctionName = LambdaName;
+	EmitBatch(EmitData, FGESPropertyPool::Name(), Payloads.GetData(), Payloads.Num());
+}
 
-	RemoveListener(BindInfo.Domain, BindInfo.Event, Listener);
+void FGESHandler::EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<UObject*> Payloads)
+{
+	EmitBatch(EmitData, FGESPropertyPool::Object(), Payloads.GetData(), Payloads.Num());
 }
 
-void FGESHandler::EmitToListenersWithData(const FGESPropertyEmitContext& EmitData, TFunction<void(const FGESEventListener&)> DataFillCallback)
+void FGESHandler::EmitBatchToListeners(const FGESPropertyEmitContext& EmitData, const FGESBatchView& Batch, FArrayProperty* ArrayProperty, const void* ArrayPtr)
 {
-	FString KeyString = Key(EmitData.Domain, EmitData.Event);
-	if (!EventMap.Contains(KeyString))
+	if (Batch.ElementProperty == nullptr || !Batch.ElementProperty->HasAnyCastFlags(SupportedEmitCastFlags))
 	{
-		CreateEvent(EmitData.Domain, EmitData.Event, false);
+		GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitBatch %s unsupported element type."), *EmitEventLogString(EmitData));
+		return;
 	}
-	FGESEvent& Event = EventMap[KeyString];
-	Event.WorldContext = EmitData.WorldContext;
-
-	if (EmitData.WorldContext == nullptr)
+	if (Batch.Num <= 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("FGESHandler::EmitToListenersWithData: Emitted event has no world context!"));
 		return;
 	}
 
-	UWorld* World = EmitData.WorldContext->GetWorld();
-	if (!World->IsValidLowLevelFast())
+	//pin and poll see the batch as its last emit
+	FGESPropertyEmitContext ElementData(EmitData);
+	ElementData.Property = Batch.ElementProperty;
+	ElementData.PropertyPtr = (void*)Batch.Get(Batch.Num - 1);
+
+	FString KeyStorage;
+	const FString& KeyString = EmitKey(ElementData, KeyStorage);
+	FGESEvent* Event = BeginEmit(ElementData, KeyString, &Batch);
+	if (!Event)
 	{
-		UE_LOG(LogTemp, Error, TEXT("FGESHandler::EmitToListenersWithData: Emitted event has no world!"));
 		return;
 	}
 
-	//Attach a world listener to each unique world
-	if (!WorldMap.Contains(World))
+	TArray<const FGESEventListener*, TInlineAllocator<4>> StaleListeners;
+	TArray<const FGESEventListener*, TInlineAllocator<16>> ElementListeners;
+	uint32 DeferredPhases = 0;
+
+	auto DeliverElement = [this, &Batch](const FGESEventListener& Listener, const void* ElementPtr)
+	{
+		if (Listener.Kind() == EGESListenerKind::Function)
+		{
+			CallListenerFunction(Listener, (void*)ElementPtr);
+		}
+		else
+		{
+			FGESWildcardProperty Wrapper;
+			Wrapper.Property = Batch.ElementProperty;
+			Wrapper.PropertyPtr = (void*)ElementPtr;
+			Listener.CallWildcard(Wrapper);
+		}
+		Stats.Deliveries++;
+	};
+
+	//Resolve each listener once: stale, whole batch, or per element
+	const FGESListenerArray::FSnapshot Snapshot = Event->Listeners.Pin();
+	for (const FGESEventListener& Listener : *Snapshot)
 	{
-		AGESWorldListenerActor* WorldListener = World->SpawnActor<AGESWorldListenerActor>();
-		WorldListener->OnEndPlay = [this, WorldListener, World]
+		if (!Listener.ReceiverWCO->IsValidLowLevelFast())
+		{
+			StaleListeners.Add(&Listener);
+			continue;
+		}
+		if (Listener.DeliveryPhase != EGESDeliveryPhase::Immediate)
+		{
+			DeferredPhases |= 1u << (uint32)Listener.DeliveryPhase;
+			continue;
+		}
+		if (Listener.bIsOneShot)
 		{
-			for (const FString& EventKey : WorldListener->WorldEvents)
+			if (Listener.IsOneShotDelivered())
 			{
-				DeleteEvent(EventKey);
+				continue;
 			}
-			WorldListener->WorldEvents.Empty();
-
-			//For now always clear receiver map if any world ends
-			ReceiverMap.Empty();
+			Listener.MarkOneShotDelivered();
+			RemoveListener(EmitData.Domain, EmitData.Event, Listener);
+		}
 
-			WorldMap.Remove(World);
-		};
-		WorldMap.Add(World, WorldListener);
-	}
+		if (Listener.Kind() != EGESListenerKind::Function)
+		{
+			if (Listener.bReceivesBatch)
+			{
+				FGESWildcardProperty Wrapper;
+				Wrapper.Property = Batch.ElementProperty;
+				Wrapper.PropertyPtr = (void*)&Batch;
+				Listener.CallWildcard(Wrapper);
+				Stats.Deliveries++;
+			}
+			else if (Listener.bIsOneShot)
+			{
+				//one-shots fire once per emit, a batch is one emit. They get its first element only.
+				DeliverElement(Listener, Batch.Get(0));
+			}
+			else
+			{
+				ElementListeners.Add(&Listener);
+			}
+			continue;
+		}
 
-	//ensure this event is registered
-	WorldMap[World]->WorldEvents.Add(KeyString);
+		//first param is cached on the listener, nothing is looked up per batch
+		FArrayProperty* ArrayParam = CastField<FArrayProperty>(Listener.GetFirstParam());
 
-	//is there a property to pin?
-	if (EmitData.Property)
-	{
-		//Warn if we're trying to pin a new event without unpinning old one
-		if (Event.bPinned && EmitData.bPinned)
+		//functions taking an array of the element type opt into whole batches
+		if (ArrayParam && ArrayParam->Inner->SameType(Batch.ElementProperty))
 		{
-			//cleanup if different
-			if (EmitData.Property != Event.PinnedData.Property ||
-				EmitData.PropertyPtr != Event.PinnedData.PropertyPtr)
+			if (ArrayProperty && ArrayParam->SameType(ArrayProperty))
 			{
-				Event.PinnedData.CleanupPinnedData();
+				CallListenerFunction(Listener, (void*)ArrayPtr);
 			}
-			
-			Event.PinnedData.bHandlePropertyDeletion = EmitData.bHandleAllocation;
-			Event.PinnedData.Property = EmitData.Property;
-
-			//only copy if ptrs are different or nullptr
-			if (EmitData.PropertyPtr != Event.PinnedData.PropertyPtr || 
-				Event.PinnedData.PropertyPtr == nullptr)
+			else
 			{
-				Event.PinnedData.PropertyPtr = EmitData.PropertyPtr;
-				Event.PinnedData.CopyPropertyToPinnedBuffer();
+				//C++ batches are views, copy them into the receiver's array type
+				TArray<uint8> ArrayBuffer;
+				ArrayBuffer.SetNumZeroed(ArrayParam->GetSize());
+				ArrayParam->InitializeValue(ArrayBuffer.GetData());
+				FScriptArrayHelper Array(ArrayParam, ArrayBuffer.GetData());
+				Array.AddValues(Batch.Num);
+				for (int32 i = 0; i < Batch.Num; i++)
+				{
+					ArrayParam->Inner->CopyCompleteValue(Array.GetRawPtr(i), Batch.Get(i));
+				}
+				CallListenerFunction(Listener, ArrayBuffer.GetData());
+				ArrayParam->DestroyValue(ArrayBuffer.GetData());
 			}
-		
-			//UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitToListenersWithData Emitted a pinned event to an already pinned event. Pinned data updated."));
+			Stats.Deliveries++;
+			continue;
 		}
-		if (!Event.bPinned && EmitData.bPinned)
+
+		if (!FunctionHasValidParams(Batch.ElementProperty->GetClass(), ElementData, Listener))
 		{
-			Event.PinnedData.CleanupPinnedData();
-			Event.PinnedData.bHandlePropertyDeletion = EmitData.bHandleAllocation;
-			Event.PinnedData.Property = EmitData.Property;
-			Event.PinnedData.PropertyPtr = EmitData.PropertyPtr;
-			Event.PinnedData.CopyPropertyToPinnedBuffer();
+			continue;
+		}
+		if (IsContainerProperty(Batch.ElementProperty) && !FunctionHasMatchingContainerParam(ElementData, Listener))
+		{
+			continue;
+		}
+		FStructProperty* StructParam = CastField<FStructProperty>(Listener.GetFirstParam());
+		FStructProperty* StructElement = CastField<FStructProperty>(Batch.ElementProperty);
+		if (Options.bValidateStructTypes && StructParam && StructElement && StructParam->Struct != StructElement->Struct)
+		{
+#if GES_EMIT_LOGGING
+			if (!Listener.bLoggedParamMismatch)
+			{
+				Listener.bLoggedParamMismatch = true;
+				UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitBatch %s skipped listener %s due to function not having a matching Struct type %s signature."),
+					*EmitEventLogString(EmitData),
+					*ListenerLogString(Listener),
+					*StructElement->Struct->GetName());
+			}
+#endif
+			continue;
 		}
-	}
-	Event.bPinned = EmitData.bPinned;
-
-
-	//only emit to this target
-	if (EmitData.SpecificTarget)
-	{
-		FGESEventListener Listener = *EmitData.SpecificTarget;
 
-		//stale listener, remove it
-		if (!Listener.ReceiverWCO->IsValidLowLevelFast())
+		if (Listener.bIsOneShot)
 		{
-			RemovalArray.Add(&Listener);
+			//first element only, see above
+			DeliverElement(Listener, Batch.Get(0));
 		}
 		else
 		{
-			//potential issue: this opt bypasses specialization via datafillcallback
-			EmitToListenerWithData(EmitData, Listener, DataFillCallback);
+			ElementListeners.Add(&Listener);
 		}
 	}
-	//emit to all targets
-	else
+
+	//Tight loop over the elements, nothing left to look up
+	for (int32 i = 0; i < Batch.Num; i++)
 	{
-		for (FGESEventListener& Listener : Event.Listeners)
+		const void* ElementPtr = Batch.Get(i);
+		for (const FGESEventListener* Listener : ElementListeners)
 		{
-			//stale listener, remove it
-			if (!Listener.ReceiverWCO->IsValidLowLevelFast())
-			{
-				RemovalArray.Add(&Listener);
-			}
-			else
+			//a callback may have destroyed a receiver of this batch
+			if (Listener->ReceiverWCO->IsValidLowLevelFast())
 			{
-				//potential issue: this opt bypasses specialization via datafillcallback
-				EmitToListenerWithData(EmitData, Listener, DataFillCallback);
+				DeliverElement(*Listener, ElementPtr);
 			}
 		}
 	}
 
-	//Go through stale listeners and remove them
-	if (RemovalArray.Num() > 0)
+	//later phases get the elements as single emits
+	if (DeferredPhases)
 	{
-		for (int i = 0; i < RemovalArray.Num(); i++)
-		{
-			FGESEventListener Listener = *RemovalArray[i];
-			Event.Listeners.Remove(Listener);
-		}
-		if (Options.bLogStaleRemovals)
+		for (int32 i = 0; i < Batch.Num; i++)
 		{
-			UE_LOG(LogTemp, Log, TEXT("FGESHandler::EmitEvent: auto-removed %d stale listeners."), RemovalArray.Num());
+			ElementData.PropertyPtr = (void*)Batch.Get(i);
+			QueueDeferredEmit(ElementData, DeferredPhases);
 		}
-		RemovalArray.Empty();
 	}
+
+	RemoveStaleListeners(KeyString, StaleListeners);
 }
 
-bool FGESHandler::EmitToListenerWithData(const FGESPropertyEmitContext& EmitData, const FGESEventListener& Listener, TFunction<void(const FGESEventListener&)>& DataFillCallback)
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, FProperty* Property, const void* PropertyPtr)
 {
-	if (Listener.ReceiverWCO->IsValidLowLevelFast())
+	LLM_SCOPE_BYTAG(GES);
+	UWorld* World = EmitData.WorldContext ? EmitData.WorldContext->GetWorld() : nullptr;
+	if (!World)
 	{
-		if (Listener.bIsBoundToLambda && Listener.LambdaFunction != nullptr)
-		{
-			//Opt1) this listener is handled by lambda
-			FGESWildcardProperty Wrapper;
-			Wrapper.Property = EmitData.Property;
-			Wrapper.PropertyPtr = EmitData.PropertyPtr;
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitDelayed No valid world context provided for %s. Not scheduled."), *EmitEventLogString(EmitData));
+		return -1;
+	}
 
-			Listener.LambdaFunction(Wrapper);
-			return true;
-		}
-		if (Listener.bIsBoundToDelegate)
-		{
-			//Opt2) this listener is handled by wildcard event delegate
-			FGESWildcardProperty Wrapper;
-			Wrapper.Property = EmitData.Property;
-			Wrapper.PropertyPtr = EmitData.PropertyPtr;
-			Listener.OnePropertyFunctionDelegate.ExecuteIfBound(Wrapper);
-			return true;
-		}
+	//schedules aren't seen by GC, only plain object payloads can be tracked (weakly, see below)
+	FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+	TArray<const FStructProperty*> EncounteredStructProps;
+	if (Property && !ObjectProperty && Property->ContainsObjectReference(EncounteredStructProps))
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESHandler::EmitDelayed %s payload %s holds object references that can't be kept until the emit is due. Not scheduled, emit the objects on their own."), *EmitEventLogString(EmitData), *Property->GetCPPType());
+		return -1;
+	}
 
-		UFunction* BPFunction = Listener.ReceiverWCO->FindFunction(FName(*Listener.FunctionName));
-		if (BPFunction != nullptr)
-		{
-			//Opt3) listener is handled by function bind by name
-			DataFillCallback(Listener);
-			return true;
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent: Function not found '%s'"), *Listener.FunctionName);
-			return false;
-		}
+	FGESWorldSchedule& WorldSchedule = WorldScheduleFor(World);
+	const int32 ScheduleHandle = NextScheduleId++;
+
+	TSharedPtr<FGESScheduledEmit> Scheduled = MakeShared<FGESScheduledEmit>();
+	Scheduled->Context = EmitData;
+	Scheduled->WorldContext = EmitData.WorldContext;
+	Scheduled->Schedule = Schedule;
+	Scheduled->RemainingEmits = (Schedule.Interval > 0.f) ? (Schedule.Count > 0 ? Schedule.Count : -1) : 1;
+
+	//the caller's value may be gone by the time this fires, keep a copy
+	Scheduled->Payload.Store(Property, PropertyPtr, false);
+	if (ObjectProperty && PropertyPtr)
+	{
+		Scheduled->bObjectPayload = true;
+		Scheduled->ObjectPayload = ObjectProperty->GetObjectPropertyValue(PropertyPtr);
 	}
-	return false;
+
+	WorldSchedule.Emits.Add(ScheduleHandle, Scheduled);
+	ScheduledEmitWorlds.Add(ScheduleHandle, World);
+	ArmScheduledEmit(World, WorldSchedule, ScheduleHandle, *Scheduled, Schedule.Delay);
+
+	return ScheduleHandle;
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, UStruct* Struct, void* StructPtr)
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule)
 {
-	bool bValidateStructs = Options.bValidateStructTypes;
-	FGESPropertyEmitContext PropData(EmitData);
-	UClass* Class = EmitData.WorldContext->GetClass();
-
-	FField* OldProperty = Class->ChildProperties;
+	return EmitDelayed(EmitData, Schedule, nullptr, nullptr);
+}
 
-	FStructProperty* StructProperty = new FStructProperty(FFieldVariant(Class), TEXT("StructProperty"), RF_NoFlags);
-	StructProperty->Struct = (UScriptStruct*)Struct;
-	StructProperty->ElementSize = Struct->GetStructureSize();
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, const FString& ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Str(), &ParamData);
+}
 
-	//undo what we just did so it won't be traversed because of init
-	Class->ChildProperties = OldProperty;
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, UObject* ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Object(), &ParamData);
+}
 
-	//Store our struct data in a buffer we can reference
-	TArray<uint8> Buffer;
-	int32 Size = Struct->GetStructureSize();
-	Buffer.SetNum(Size);
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, float ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Float(), &ParamData);
+}
 
-	//StructProperty->CopyCompleteValue(Buffer.GetData(), StructPtr);
-	FPlatformMemory::Memcpy(Buffer.GetData(), StructPtr, Size);
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, int32 ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Int(), &ParamData);
+}
 
-	PropData.Property = StructProperty;
-	PropData.PropertyPtr = Buffer.GetData();
-	if (PropData.bPinned)
-	{
-		PropData.bHandleAllocation = true;
-	}
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, bool ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Bool(), &ParamData);
+}
 
-	EmitToListenersWithData(PropData, [&PropData, &Struct, &Buffer, bValidateStructs](const FGESEventListener& Listener)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent struct Emit called"));
+int32 FGESHandler::EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, const FName& ParamData)
+{
+	return EmitDelayed(EmitData, Schedule, FGESPropertyPool::Name(), &ParamData);
+}
 
-		if (FunctionHasValidParams(Listener.Function, FStructProperty::StaticClass(), PropData, Listener))
-		{
-			if (bValidateStructs)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Validation emit"));
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, FProperty* Property, const void* PropertyPtr)
+{
+	FGESPropertyEmitContext PropData(EmitData);
+	PropData.Property = Property;
+	PropData.PropertyPtr = const_cast<void*>(PropertyPtr);
+	PropData.bLocated = true;
+	PropData.Location = Location;
+	PropData.Radius = FMath::Max(Radius, 0.f);
 
-				//For structs we can have different mismatching structs at this point check class types
-				//optimization note: unroll the above function for structs to avoid double param lookup
-				TArray<FProperty*> Properties;
-				FunctionParameters(Listener.Function, Properties);
-				FStructProperty* SubStructProperty = CastField<FStructProperty>(Properties[0]);
-				if (SubStructProperty->Struct == Struct)
-				{
-					Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent %s skipped listener %s due to function not having a matching Struct type %s signature."),
-						*EmitEventLogString(PropData),
-						*ListenerLogString(Listener),
-						*Struct->GetName());
-				}
-			}
-			//No validation, e.g. vector-> rotator fill is accepted
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("No validation emit"));
-				Listener.ReceiverWCO->ProcessEvent(Listener.Function, (void*)Buffer.GetData()); //PropData.PropertyPtr); //
-			}
-		}
-	});
+	EmitPropertyEvent(PropData);
+}
 
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius)
+{
+	EmitAtLocation(EmitData, Location, Radius, nullptr, nullptr);
+}
 
-	if (!EmitData.bPinned)
-	{
-		delete StructProperty;
-	}
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, const FString& ParamData)
+{
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Str(), &ParamData);
+}
+
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, UObject* ParamData)
+{
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Object(), &ParamData);
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const FString& ParamData)
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, float ParamData)
 {
-	FGESPropertyEmitContext PropData(EmitData);
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Float(), &ParamData);
+}
 
-	//We have no property context, make a new property
-	FStrProperty* StrProperty = 
-		new FStrProperty(FFieldVariant(EmitData.WorldContext->GetClass()),
-			TEXT("StringValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, int32 ParamData)
+{
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Int(), &ParamData);
+}
 
-	//Wrap our FString into a buffer we can share
-	TArray<uint8> Buffer;
-	Buffer.SetNum(ParamData.GetAllocatedSize());
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, bool ParamData)
+{
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Bool(), &ParamData);
+}
 
-	StrProperty->SetPropertyValue_InContainer(Buffer.GetData(), ParamData);
+void FGESHandler::EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, const FName& ParamData)
+{
+	EmitAtLocation(EmitData, Location, Radius, FGESPropertyPool::Name(), &ParamData);
+}
 
-	PropData.Property = StrProperty;
-	PropData.PropertyPtr = Buffer.GetData();
-	if (PropData.bPinned)
+bool FGESHandler::CancelScheduledEmit(int32 ScheduleHandle)
+{
+	FGESWorldSchedule* WorldSchedule = nullptr;
+	FGESScheduledEmit* Scheduled = FindScheduledEmit(ScheduleHandle, &WorldSchedule);
+	if (!Scheduled)
 	{
-		PropData.bHandleAllocation = true;
+		return false;
 	}
 
-	EmitToListenersWithData(PropData, [&PropData, ParamData](const FGESEventListener& Listener)
-	{
-		if (FunctionHasValidParams(Listener.Function, FStrProperty::StaticClass(), PropData, Listener))
-		{
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);// (void*)*MutableString); // (void*)&ParamData);
-		}
-	});
+	FGESTimerWheel& Wheel = (Scheduled->Schedule.Unit == EGESScheduleUnit::Frames) ? WorldSchedule->FrameWheel : WorldSchedule->TimeWheel;
+	Wheel.Cancel(Scheduled->WheelHandle);
+	RemoveScheduledEmit(*WorldSchedule, ScheduleHandle);
+	return true;
+}
 
-	if (!EmitData.bPinned)
+FGESWorldSchedule& FGESHandler::WorldScheduleFor(UWorld* World)
+{
+	//spawns the listener that drops this schedule when the world ends
+	WorldListenerFor(World);
+
+	TUniquePtr<FGESWorldSchedule>& WorldSchedule = WorldSchedules.FindOrAdd(World);
+	if (!WorldSchedule.IsValid())
 	{
-		delete StrProperty;
+		WorldSchedule = MakeUnique<FGESWorldSchedule>();
 	}
+	return *WorldSchedule;
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, UObject* ParamData)
+FGESScheduledEmit* FGESHandler::FindScheduledEmit(int32 ScheduleHandle, FGESWorldSchedule** OutSchedule)
 {
-	FGESPropertyEmitContext PropData(EmitData);
-
-	FObjectProperty* ObjectProperty =
-		new FObjectProperty(FFieldVariant(EmitData.WorldContext->GetClass()),
-			TEXT("ObjectValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
-
-	//wrapper required to avoid copied pointer to become the first function
-	FGESDynamicArg ParamWrapper;
-	ParamWrapper.Arg01 = ParamData;
-
-	PropData.Property = ObjectProperty;
-	PropData.PropertyPtr = (void*)&ParamWrapper;
-	
-	if (PropData.bPinned)
+	UWorld** World = ScheduledEmitWorlds.Find(ScheduleHandle);
+	TUniquePtr<FGESWorldSchedule>* WorldSchedule = World ? WorldSchedules.Find(*World) : nullptr;
+	if (!WorldSchedule)
 	{
-		PropData.bHandleAllocation = true;
+		return nullptr;
 	}
 
-	EmitToListenersWithData(PropData, [&PropData, ParamWrapper](const FGESEventListener& Listener)
+	TSharedPtr<FGESScheduledEmit>* Scheduled = (*WorldSchedule)->Emits.Find(ScheduleHandle);
+	if (!Scheduled)
 	{
-		if (FunctionHasValidParams(Listener.Function, FObjectProperty::StaticClass(), PropData, Listener))
-		{
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, (void*)&ParamWrapper);// PropData.PropertyPtr);
-		}
-	});
+		return nullptr;
+	}
 
-	if (!EmitData.bPinned)
+	if (OutSchedule)
 	{
-		delete ObjectProperty;
+		*OutSchedule = WorldSchedule->Get();
 	}
+	return Scheduled->Get();
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, float ParamData)
+void FGESHandler::ArmScheduledEmit(UWorld* World, FGESWorldSchedule& Schedule, int32 ScheduleHandle, FGESScheduledEmit& Scheduled, float Delay)
 {
-	FGESPropertyEmitContext PropData(EmitData);
-
-	FGESWildcardProperty WrapperProperty;
-
-	FFloatProperty* FloatProperty =
-		new FFloatProperty(FFieldVariant(EmitData.WorldContext->GetClass()),//WrapperProperty),
-			TEXT("FloatValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
+	TFunction<void()> OnDue = [this, World, ScheduleHandle]()
+	{
+		FireScheduledEmit(World, ScheduleHandle);
+	};
 
-	PropData.Property = FloatProperty;
-	PropData.PropertyPtr = &ParamData;// Buffer.GetData();
-	if (PropData.bPinned)
+	if (Scheduled.Schedule.Unit == EGESScheduleUnit::Frames)
 	{
-		PropData.bHandleAllocation = true;
+		Scheduled.WheelHandle = Schedule.FrameWheel.AddTicks((uint64)FMath::Max(FMath::CeilToInt(Delay), 1), MoveTemp(OnDue));
 	}
-
-	EmitToListenersWithData(PropData, [&PropData, &ParamData](const FGESEventListener& Listener)
+	else
 	{
-		if (FunctionHasValidParams(Listener.Function, FNumericProperty::StaticClass(), PropData, Listener))
-		{
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);// PropData.PropertyPtr);
-		}
-	});
+		Scheduled.WheelHandle = Schedule.TimeWheel.Add(Delay, Schedule.WorldTime, MoveTemp(OnDue));
+	}
 
-	if (!EmitData.bPinned)
+	//the world listener only ticks while something is scheduled
+	AGESWorldListenerActor* WorldListener = WorldMap.FindRef(World);
+	if (IsValid(WorldListener) && !WorldListener->IsActorTickEnabled())
 	{
-		delete FloatProperty;
+		WorldListener->SetActorTickEnabled(true);
 	}
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, int32 ParamData)
+void FGESHandler::FireScheduledEmit(UWorld* World, int32 ScheduleHandle)
 {
-	FGESPropertyEmitContext PropData(EmitData);
-
-	FIntProperty* IntProperty =
-		new FIntProperty(FFieldVariant(EmitData.WorldContext->GetClass()),
-			TEXT("IntValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
-
-	PropData.Property = IntProperty;
-	PropData.PropertyPtr = &ParamData;
-	if (PropData.bPinned)
+	TUniquePtr<FGESWorldSchedule>* FoundSchedule = WorldSchedules.Find(World);
+	if (!FoundSchedule)
 	{
-		PropData.bHandleAllocation = true;
+		return;
 	}
+	FGESWorldSchedule& WorldSchedule = **FoundSchedule;
 
-	EmitToListenersWithData(PropData, [&PropData](const FGESEventListener& Listener)
+	//hold on to it while emitting, listeners may cancel it
+	TSharedPtr<FGESScheduledEmit> Scheduled = WorldSchedule.Emits.FindRef(ScheduleHandle);
+	if (!Scheduled.IsValid())
 	{
-		if (FunctionHasValidParams(Listener.Function, FNumericProperty::StaticClass(), PropData, Listener))
-		{
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);
-		}
-	});
+		return;
+	}
 
-	if (!EmitData.bPinned)
+	UObject* WorldContext = Scheduled->WorldContext.Get();
+	if (!WorldContext)
 	{
-		delete IntProperty;
+		//emitter is gone, so is its schedule
+		RemoveScheduledEmit(WorldSchedule, ScheduleHandle);
+		return;
 	}
-}
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, bool ParamData)
-{
-	FGESPropertyEmitContext PropData(EmitData);
-
-	FBoolProperty* BoolProperty =
-		new FBoolProperty(FFieldVariant(EmitData.WorldContext->GetClass()),
-			TEXT("BoolValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
-
-	PropData.Property = BoolProperty;
-	PropData.PropertyPtr = &ParamData;
-	if (PropData.bPinned)
+	//the next repeat is armed before emitting so listeners can cancel it
+	if (Scheduled->RemainingEmits == 1)
 	{
-		PropData.bHandleAllocation = true;
+		RemoveScheduledEmit(WorldSchedule, ScheduleHandle);
 	}
-
-	EmitToListenersWithData(PropData, [&PropData](const FGESEventListener& Listener)
+	else
 	{
-		if (FunctionHasValidParams(Listener.Function, FBoolProperty::StaticClass(), PropData, Listener))
+		if (Scheduled->RemainingEmits > 0)
 		{
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);
+			Scheduled->RemainingEmits--;
 		}
-	});
-
-	if (!EmitData.bPinned)
-	{
-		delete BoolProperty;
+		ArmScheduledEmit(World, WorldSchedule, ScheduleHandle, *Scheduled, Scheduled->Schedule.Interval);
 	}
-}
-
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const FName& ParamData)
-{
-	FGESPropertyEmitContext PropData(EmitData);
-
-	//We have no property context, make a new property
-	FNameProperty* NameProperty =
-		new FNameProperty(FFieldVariant(EmitData.WorldContext->GetClass()),
-			TEXT("NameValue"),
-			EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
 
-	//Wrap our FName into a buffer we can share
-	TArray<uint8> Buffer;
-	Buffer.SetNum(ParamData.StringBufferSize);
+	FGESEmitContext EmitData = Scheduled->Context;
+	EmitData.WorldContext = WorldContext;
 
-	NameProperty->SetPropertyValue_InContainer(Buffer.GetData(), ParamData);
-
-	PropData.Property = NameProperty;
-	PropData.PropertyPtr = Buffer.GetData();
-	if (PropData.bPinned)
+	FGESPollSlot& Payload = Scheduled->Payload;
+	if (!Payload.bHasValue)
 	{
-		PropData.bHandleAllocation = true;
+		EmitEvent(EmitData);
+		return;
 	}
 
-	EmitToListenersWithData(PropData, [&PropData, ParamData](const FGESEventListener& Listener)
-		{
-			if (FunctionHasValidParams(Listener.Function, FStrProperty::StaticClass(), PropData, Listener))
-			{
-				Listener.ReceiverWCO->ProcessEvent(Listener.Function, PropData.PropertyPtr);
-			}
-		});
-
-	if (!EmitData.bPinned)
+	if (Scheduled->bObjectPayload)
 	{
-		delete NameProperty;
+		CastField<FObjectPropertyBase>(Payload.Property)->SetObjectPropertyValue(Payload.Buffer.GetData(), Scheduled->ObjectPayload.Get());
 	}
+	EmitEvent(EmitData, Payload.Property, Payload.Buffer.GetData());
 }
 
-bool FGESHandler::EmitEvent(const FGESEmitContext& EmitData)
+void FGESHandler::RemoveScheduledEmit(FGESWorldSchedule& Schedule, int32 ScheduleHandle)
 {
-	FGESPropertyEmitContext FullEmitData(EmitData);
-
-	//No param version
-	return EmitPropertyEvent(FullEmitData);
+	Schedule.Emits.Remove(ScheduleHandle);
+	ScheduledEmitWorlds.Remove(ScheduleHandle);
 }
 
-void FGESHandler::EmitEvent(const FGESEmitContext& EmitData, const GES_RAW_TEXT RawStringMessage)
+void FGESHandler::TickWorldSchedule(UWorld* World, float DeltaSeconds)
 {
-	EmitEvent(EmitData, FString(RawStringMessage));
+	TUniquePtr<FGESWorldSchedule>* FoundSchedule = WorldSchedules.Find(World);
+
+	//the schedule itself stays put if emits schedule into other worlds and the map grows
+	FGESWorldSchedule* WorldSchedule = FoundSchedule ? FoundSchedule->Get() : nullptr;
+	if (WorldSchedule)
+	{
+		WorldSchedule->WorldTime += DeltaSeconds;
+		if (WorldSchedule->FrameWheel.Num() > 0)
+		{
+			WorldSchedule->FrameWheel.Tick();
+		}
+		WorldSchedule->TimeWheel.Advance(WorldSchedule->WorldTime);
+	}
+
+	if (!WorldSchedule || WorldSchedule->Emits.Num() == 0)
+	{
+		AGESWorldListenerActor* WorldListener = WorldMap.FindRef(World);
+		if (IsValid(WorldListener))
+		{
+			WorldListener->SetActorTickEnabled(false);
+		}
+	}
 }
 
 bool FGESHandler::EmitPropertyEvent(const FGESPropertyEmitContext& EmitData)
 {
-	//UE_LOG(LogTemp, Log, TEXT("World is: %s"), *EmitData.WorldContext.Get()->GetName());
+	//UE_LOG(LogGES, Log, TEXT("World is: %s"), *EmitData.WorldContext.Get()->GetName());
 
 	if (!EmitData.WorldContext || !EmitData.WorldContext->IsValidLowLevel())
 	{
@@ -857,7 +2936,7 @@ bool FGESHandler::EmitPropertyEvent(const FGESPropertyEmitContext& EmitData)
 		DeleteEvent(EmitData.Domain, EmitData.Event);
 		if (Options.bLogStaleRemovals)
 		{
-			UE_LOG(LogTemp, Log, TEXT("FGESHandler::EmitEvent stale event removed due to invalid world context for <%s.%s>. (Usually due to pinned events that haven't been unpinned)"),
+			GES_EMIT_LOG(Log, TEXT("FGESHandler::EmitEvent stale event removed due to invalid world context for <%s.%s>. (Usually due to pinned events that haven't been unpinned)"),
 				*EmitData.Domain, *EmitData.Event);
 		}
 		return false;
@@ -893,7 +2972,7 @@ bool FGESHandler::EmitPropertyEvent(const FGESPropertyEmitContext& EmitData)
 				}*/
 
 				//Neither lambda nor wildcard delegate, process no param prop
-				TFieldIterator<FProperty> Iterator(Listener.Function);
+				TFieldIterator<FProperty> Iterator(Listener.GetFunction());
 
 				TArray<FProperty*> Properties;
 				while (Iterator && (Iterator->PropertyFlags & CPF_Parm))
@@ -904,51 +2983,28 @@ bool FGESHandler::EmitPropertyEvent(const FGESPropertyEmitContext& EmitData)
 				}
 				if (Properties.Num() == 0)
 				{
-					Listener.ReceiverWCO->ProcessEvent(Listener.Function, nullptr);
+					CallListenerFunction(Listener, nullptr);
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent %s tried to emit an empty event to %s receiver expecting parameters."),
+					GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitEvent %s tried to emit an empty event to %s receiver expecting parameters."),
 						*EmitData.Event,
 						*Listener.ReceiverWCO->GetName());
 				}
 			});
-	}
-	else if (ParameterProp->IsA<FStructProperty>())
-	{
-		EmitSubPropertyEvent(EmitData);
-		return true;
-	}
-	else if (ParameterProp->IsA<FStrProperty>())
-	{
-		EmitSubPropertyEvent(EmitData);
-		return true;
-	}
-	else if (ParameterProp->IsA<FObjectProperty>())
-	{
-		EmitSubPropertyEvent(EmitData);
 		return true;
 	}
-	else if (ParameterProp->IsA<FNumericProperty>())
+	else if (ParameterProp->HasAnyCastFlags(SupportedEmitCastFlags))
 	{
+		//Structs, strings, objects, numbers, bools, names and containers (passed as views of the emitter's container)
+		//all take the same path. One cast flag test instead of walking the type chain per emit.
 		//todo warn numeric mismatch again (int/float)
 		EmitSubPropertyEvent(EmitData);
 		return true;
 	}
-	else if (ParameterProp->IsA<FBoolProperty>())
-	{
-		EmitSubPropertyEvent(EmitData);
-		return true;
-	}
-	else if (ParameterProp->IsA<FNameProperty>())
-	{
-		EmitSubPropertyEvent(EmitData);
-		return true;
-	}
 	else
 	{
-		//Maps, Array, Sets etc unsupported atm
-		UE_LOG(LogTemp, Warning, TEXT("FGESHandler::EmitEvent Unsupported parameter"));
+		GES_EMIT_LOG(Warning, TEXT("FGESHandler::EmitEvent Unsupported parameter"));
 		return false;
 	}
 	return false;
@@ -958,8 +3014,18 @@ void FGESHandler::EmitSubPropertyEvent(const FGESPropertyEmitContext& EmitData)
 {
 	EmitToListenersWithData(EmitData, [&EmitData](const FGESEventListener& Listener)
 	{
-		if (FunctionHasValidParams(Listener.Function, EmitData.Property->StaticClass(), EmitData, Listener))
+		if (FunctionHasValidParams(EmitData.Property->StaticClass(), EmitData, Listener))
 		{
+			if (IsContainerProperty(EmitData.Property) && !FunctionHasMatchingContainerParam(EmitData, Listener))
+			{
+				return;
+			}
+			FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(EmitData.Property);
+			if (ObjectProperty && !FunctionAcceptsObject(ObjectProperty->GetObjectPropertyValue(EmitData.PropertyPtr), EmitData, Listener))
+			{
+				return;
+			}
+
 			/*
 			Never gets called?
 			//Lambda Bind
@@ -983,7 +3049,7 @@ void FGESHandler::EmitSubPropertyEvent(const FGESPropertyEmitContext& EmitData)
 			}*/
 
 			//Standard Function Name Bind
-			Listener.ReceiverWCO->ProcessEvent(Listener.Function, EmitData.PropertyPtr);
+			CallListenerFunction(Listener, EmitData.PropertyPtr);
 		}
 	});
 }
@@ -993,6 +3059,222 @@ void FGESHandler::SetOptions(const FGESGlobalOptions& InOptions)
 	Options = InOptions;
 }
 
+FName FGESHandler::GetBusName() const
+{
+	return BusName;
+}
+
+bool FGESHandler::IsScoped() const
+{
+	return bIsScoped;
+}
+
+TSharedPtr<FGESHandler> FGESHandler::MakeScoped(FName ScopeName)
+{
+	TSharedPtr<FGESHandler> ScopedBus = MakeShareable(new FGESHandler());
+	ScopedBus->BusName = ScopeName;
+	ScopedBus->bIsScoped = true;
+	PrivateScopedBuses.Add(ScopedBus.Get(), ScopedBus);
+	return ScopedBus;
+}
+
+void FGESHandler::ReleaseWorldListeners()
+{
+	//their end play callbacks point at this handler
+	for (const TPair<UWorld*, AGESWorldListenerActor*>& Pair : WorldMap)
+	{
+		AGESWorldListenerActor* WorldListener = Pair.Value;
+		if (IsValid(WorldListener))
+		{
+			WorldListener->OnEndPlay = nullptr;
+			WorldListener->OnTick = nullptr;
+			WorldListener->Destroy();
+		}
+	}
+	WorldMap.Empty();
+
+	//unregisters the phase tick functions
+	WorldPhases.Empty();
+}
+
+FGESBusStats FGESHandler::GetStats() const
+{
+	FGESBusStats Current = Stats;
+	Current.Events = EventMap.Num();
+	Current.Listeners = 0;
+	for (const TPair<FString, FGESEvent>& Pair : EventMap)
+	{
+		Current.Listeners += Pair.Value.Listeners.Num();
+	}
+	return Current;
+}
+
+void FGESHandler::ResetStats()
+{
+	Stats = FGESBusStats();
+}
+
+FGESMemoryStats FGESHandler::GetMemoryStats(int32 TopDomainCount) const
+{
+	FGESMemoryStats MemoryStats;
+	MemoryStats.Events = EventMap.Num();
+	MemoryStats.EventBytes = EventMap.GetAllocatedSize();
+
+	TMap<FString, SIZE_T> DomainBytes;
+
+	for (const TPair<FString, FGESEvent>& Pair : EventMap)
+	{
+		const FGESEvent& Event = Pair.Value;
+
+		SIZE_T Bytes = sizeof(TPair<FString, FGESEvent>);
+		const SIZE_T StringBytes = Pair.Key.GetAllocatedSize() + Event.Domain.GetAllocatedSize() + Event.Event.GetAllocatedSize();
+		MemoryStats.EventBytes += StringBytes;
+		Bytes += StringBytes;
+
+		const TArray<FGESEventListener>& Listeners = Event.Listeners.Get();
+		const SIZE_T Slack = Listeners.GetAllocatedSize() - Listeners.Num() * sizeof(FGESEventListener);
+		MemoryStats.EventBytes += Slack;
+		Bytes += Listeners.GetAllocatedSize();
+
+		for (const FGESEventListener& Listener : Listeners)
+		{
+			SIZE_T ListenerBytes = sizeof(FGESEventListener);
+			if (Listener.Extras.IsValid())
+			{
+				ListenerBytes += sizeof(FGESListenerExtras);
+			}
+			Bytes += ListenerBytes - sizeof(FGESEventListener);
+
+			switch (Listener.Kind())
+			{
+			case EGESListenerKind::Function:
+				MemoryStats.FunctionListenerBytes += ListenerBytes;
+				MemoryStats.FunctionListeners++;
+				break;
+			case EGESListenerKind::Delegate:
+				MemoryStats.DelegateListenerBytes += ListenerBytes;
+				MemoryStats.DelegateListeners++;
+				break;
+			default:
+				MemoryStats.LambdaListenerBytes += ListenerBytes;
+				MemoryStats.LambdaListeners++;
+				break;
+			}
+		}
+
+		SIZE_T PinnedBytes = Event.PinnedData.PropertyData.GetAllocatedSize();
+		if (Event.PinnedData.bPropertyDataInitialized)
+		{
+			PinnedBytes += ValueHeapBytes(Event.PinnedData.Property, Event.PinnedData.PropertyData.GetData());
+		}
+		if (Event.bPinned)
+		{
+			MemoryStats.PinnedEvents++;
+		}
+		MemoryStats.PinnedBytes += PinnedBytes;
+		Bytes += PinnedBytes;
+
+		SIZE_T PollBytes = Event.PollSlot.Buffer.GetAllocatedSize();
+		if (Event.PollSlot.bHasValue)
+		{
+			PollBytes += ValueHeapBytes(Event.PollSlot.Property, Event.PollSlot.Buffer.GetData());
+		}
+		MemoryStats.PollBytes += PollBytes;
+		Bytes += PollBytes;
+
+		if (Event.SpatialIndex.IsValid())
+		{
+			const SIZE_T GridBytes = sizeof(FGESSpatialIndex) + Event.SpatialIndex->GetAllocatedSize();
+			MemoryStats.OtherBytes += GridBytes;
+			Bytes += GridBytes;
+		}
+
+		DomainBytes.FindOrAdd(Event.Domain) += Bytes;
+	}
+
+	MemoryStats.ReceiverIndexBytes = ReceiverMap.GetAllocatedSize();
+	for (const TPair<UObject*, TArray<FGESReceiverBind>>& Pair : ReceiverMap)
+	{
+		MemoryStats.ReceiverIndexBytes += Pair.Value.GetAllocatedSize();
+	}
+
+	MemoryStats.WorldBytes = WorldMap.GetAllocatedSize();
+	for (const TPair<UWorld*, AGESWorldListenerActor*>& Pair : WorldMap)
+	{
+		if (IsValid(Pair.Value))
+		{
+			MemoryStats.WorldBytes += Pair.Value->WorldEvents.GetAllocatedSize();
+			for (const FString& EventKey : Pair.Value->WorldEvents)
+			{
+				MemoryStats.WorldBytes += EventKey.GetAllocatedSize();
+			}
+		}
+	}
+
+	//listener grids were added per event above
+	MemoryStats.OtherBytes += RequestTable.GetAllocatedSize() + FreeRequestSlots.GetAllocatedSize() +
+		Joins.GetAllocatedSize() + JoinIdsByKey.GetAllocatedSize() + JoinHandles.GetAllocatedSize() +
+		(TimeoutWheel.IsValid() ? TimeoutWheel->GetAllocatedSize() : 0);
+	for (const TPair<FString, int32>& Pair : JoinIdsByKey)
+	{
+		MemoryStats.OtherBytes += Pair.Key.GetAllocatedSize();
+	}
+
+	//scheduled emits with their payload copies
+	MemoryStats.OtherBytes += WorldSchedules.GetAllocatedSize() + ScheduledEmitWorlds.GetAllocatedSize();
+	for (const TPair<UWorld*, TUniquePtr<FGESWorldSchedule>>& Pair : WorldSchedules)
+	{
+		const FGESWorldSchedule& WorldSchedule = *Pair.Value;
+		MemoryStats.OtherBytes += sizeof(FGESWorldSchedule) + WorldSchedule.TimeWheel.GetAllocatedSize() +
+			WorldSchedule.FrameWheel.GetAllocatedSize() + WorldSchedule.Emits.GetAllocatedSize();
+		for (const TPair<int32, TSharedPtr<FGESScheduledEmit>>& EmitPair : WorldSchedule.Emits)
+		{
+			const FGESScheduledEmit& Scheduled = *EmitPair.Value;
+			MemoryStats.OtherBytes += sizeof(FGESScheduledEmit) + Scheduled.Context.Domain.GetAllocatedSize() +
+				Scheduled.Context.Event.GetAllocatedSize() + Scheduled.Payload.Buffer.GetAllocatedSize();
+			if (Scheduled.Payload.bHasValue)
+			{
+				MemoryStats.OtherBytes += ValueHeapBytes(Scheduled.Payload.Property, Scheduled.Payload.Buffer.GetData());
+			}
+		}
+	}
+
+	//queued deliveries of later phases
+	MemoryStats.OtherBytes += WorldPhases.GetAllocatedSize();
+	for (const TPair<UWorld*, TUniquePtr<FGESWorldPhases>>& Pair : WorldPhases)
+	{
+		MemoryStats.OtherBytes += sizeof(FGESWorldPhases);
+		for (int32 PhaseIndex = 0; PhaseIndex < FGESWorldPhases::NumDeferredPhases; PhaseIndex++)
+		{
+			MemoryStats.OtherBytes += Pair.Value->Queues[PhaseIndex].GetAllocatedSize();
+			if (Pair.Value->TickFunctions[PhaseIndex].IsValid())
+			{
+				MemoryStats.OtherBytes += sizeof(FGESPhaseTickFunction);
+			}
+			for (const FGESDeferredEmit& Deferred : Pair.Value->Queues[PhaseIndex])
+			{
+				MemoryStats.OtherBytes += Deferred.Context.Domain.GetAllocatedSize() + Deferred.Context.Event.GetAllocatedSize() +
+					Deferred.Payload.Buffer.GetAllocatedSize();
+			}
+		}
+	}
+
+	DomainBytes.ValueSort([](SIZE_T A, SIZE_T B)
+	{
+		return A > B;
+	});
+	for (const TPair<FString, SIZE_T>& Pair : DomainBytes)
+	{
+		if (MemoryStats.TopDomains.Num() >= TopDomainCount)
+		{
+			break;
+		}
+		MemoryStats.TopDomains.Add(Pair);
+	}
+
+	return MemoryStats;
+}
+
 FString FGESHandler::Key(const FString& Domain, const FString& Event)
 {
 	return Domain + TEXT(".") + Event;
@@ -1000,7 +3282,10 @@ FString FGESHandler::Key(const FString& Domain, const FString& Event)
 
 FGESHandler::FGESHandler()
 {
-
+	NextLambdaId = 0;
+	NextPinnedVersion = 0;
+	BusName = NAME_None;
+	bIsScoped = false;
 }
 
 FGESHandler::~FGESHandler()
@@ -1013,5 +3298,59 @@ FGESHandler::~FGESHandler()
 			Pair.Value.PinnedData.CleanupPinnedData();
 		}
 	}*/
+	if (TimeoutTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TimeoutTickerHandle);
+	}
+	if (CompactionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CompactionTickerHandle);
+	}
+	if (bIsScoped)
+	{
+		PrivateScopedBuses.Remove(this);
+
+		//the other buses outlive this one, pending joins must not stay bound there. Actor scoped inputs are on
+		//this bus or another actor's scope that ends on its own.
+		for (const TPair<int32, FGESJoin>& Pair : Joins)
+		{
+			if (!Pair.Value.bCompleted)
+			{
+				RemoveJoinListeners(Pair.Value, Pair.Key, false);
+			}
+		}
+	}
 	EventMap.Empty();
 }
+
+static FAutoConsoleCommandWithArgsAndOutputDevice GESMemReportCommand(
+	TEXT("ges.MemReport"),
+	TEXT("ges.MemReport [TopDomains=10]. Approximate memory held by the default handler and each bus."),
+	FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const int32 TopDomainCount = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10;
+
+		FGESHandler::ForEachHandler([&Ar, TopDomainCount](FGESHandler& Handler)
+		{
+			const FGESMemoryStats MemoryStats = Handler.GetMemoryStats(TopDomainCount);
+			const FName HandlerBusName = Handler.GetBusName();
+
+			Ar.Logf(TEXT("GES %s: %s total"), HandlerBusName.IsNone() ? TEXT("default handler") : *(TEXT("bus ") + HandlerBusName.ToString()),
+				*MemoryString(MemoryStats.TotalBytes()));
+			Ar.Logf(TEXT("  Events: %d, %s"), MemoryStats.Events, *MemoryString(MemoryStats.EventBytes));
+			Ar.Logf(TEXT("  Listeners: %s (function %d %s, delegate %d %s, lambda %d %s)"), *MemoryString(MemoryStats.ListenerBytes()),
+				MemoryStats.FunctionListeners, *MemoryString(MemoryStats.FunctionListenerBytes),
+				MemoryStats.DelegateListeners, *MemoryString(MemoryStats.DelegateListenerBytes),
+				MemoryStats.LambdaListeners, *MemoryString(MemoryStats.LambdaListenerBytes));
+			Ar.Logf(TEXT("  Pinned: %d events, %s"), MemoryStats.PinnedEvents, *MemoryString(MemoryStats.PinnedBytes));
+			Ar.Logf(TEXT("  Polled values: %s"), *MemoryString(MemoryStats.PollBytes));
+			Ar.Logf(TEXT("  Receiver index: %s"), *MemoryString(MemoryStats.ReceiverIndexBytes));
+			Ar.Logf(TEXT("  World bookkeeping: %s"), *MemoryString(MemoryStats.WorldBytes));
+			Ar.Logf(TEXT("  Requests, joins, timers, queues and grids: %s"), *MemoryString(MemoryStats.OtherBytes));
+
+			for (const TPair<FString, SIZE_T>& Domain : MemoryStats.TopDomains)
+			{
+				Ar.Logf(TEXT("    %s: %s"), *Domain.Key, *MemoryString(Domain.Value));
+			}
+		});
+	}));
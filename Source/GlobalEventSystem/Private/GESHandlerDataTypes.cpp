@@ -4,19 +4,27 @@ void FGESPinnedData::CopyPropertyToPinnedBuffer()
 {
 	//Copy this property data to temp
 	{
-		//Workaround for our generated struct
-		int32 Num = Property->GetSize();
-		/*if (Property->IsA<FStructProperty>())
+		void* SourcePtr = PropertyPtr;
+
+		//Release any previously held value before re-using the buffer
+		if (bPropertyDataInitialized)
 		{
-			FStructProperty* StructProp = CastField<FStructProperty>(Property);
-			if (StructProp->Struct)
+			if (SourcePtr == PropertyData.GetData())
 			{
-				Num = StructProp->Struct->PropertiesSize;
+				//already holding this value
+				return;
 			}
-		}*/
-		
+			Property->DestroyValue(PropertyData.GetData());
+			bPropertyDataInitialized = false;
+		}
+
+		int32 Num = Property->GetSize();
 		PropertyData.SetNumUninitialized(Num);
-		FMemory::Memcpy(PropertyData.GetData(), PropertyPtr, Num);
+
+		//Property aware copy, a raw memcpy would alias string/container allocations of the emitter
+		Property->InitializeValue(PropertyData.GetData());
+		Property->CopyCompleteValue(PropertyData.GetData(), SourcePtr);
+		bPropertyDataInitialized = true;
 
 		//reset pointer to new copy
 		PropertyPtr = PropertyData.GetData();
@@ -25,6 +33,11 @@ void FGESPinnedData::CopyPropertyToPinnedBuffer()
 
 void FGESPinnedData::CleanupPinnedData()
 {
+	if (bPropertyDataInitialized && Property != nullptr)
+	{
+		Property->DestroyValue(PropertyData.GetData());
+	}
+	bPropertyDataInitialized = false;
 	PropertyData.Empty();
 
 	//Some properties are being allocated in C++, we need to clean them here
@@ -40,9 +53,118 @@ void FGESPinnedData::CleanupPinnedData()
 	PropertyPtr = nullptr;
 }
 
+void FGESPollSlot::Store(FProperty* InProperty, const void* InPropertyPtr, bool bIsTemporary)
+{
+	if (InProperty == nullptr || InPropertyPtr == nullptr)
+	{
+		//no param emit, nothing to poll
+		Reset();
+		return;
+	}
+
+	//different type, buffer layout changes
+	if (Property && Property != InProperty && !Property->SameType(InProperty))
+	{
+		Reset();
+	}
+
+	if (Property == nullptr)
+	{
+		if (bIsTemporary)
+		{
+			Property = CastField<FProperty>(FField::Duplicate(InProperty, InProperty->GetOwnerVariant()));
+			bOwnsProperty = true;
+		}
+		else
+		{
+			Property = InProperty;
+			bOwnsProperty = false;
+		}
+	}
+	else if (!bOwnsProperty && !bIsTemporary)
+	{
+		//same layout, prefer the live property
+		Property = InProperty;
+	}
+
+	if (!bHasValue)
+	{
+		Buffer.SetNumUninitialized(Property->GetSize());
+		Property->InitializeValue(Buffer.GetData());
+		bHasValue = true;
+	}
+	Property->CopyCompleteValue(Buffer.GetData(), InPropertyPtr);
+}
+
+void FGESPollSlot::Reset()
+{
+	if (bHasValue && Property != nullptr)
+	{
+		Property->DestroyValue(Buffer.GetData());
+	}
+	bHasValue = false;
+	Buffer.Empty();
+
+	if (bOwnsProperty && Property != nullptr)
+	{
+		Property->SetFlags(RF_BeginDestroyed);
+		delete Property;
+	}
+	Property = nullptr;
+	bOwnsProperty = false;
+}
+
+FGESListenerArray::FGESListenerArray()
+{
+	Array = MakeShared<TArray<FGESEventListener>, ESPMode::NotThreadSafe>();
+}
+
+const TArray<FGESEventListener>& FGESListenerArray::Get() const
+{
+	return *Array;
+}
+
+FGESListenerArray::FSnapshot FGESListenerArray::Pin() const
+{
+	return Array;
+}
+
+TArray<FGESEventListener>& FGESListenerArray::Mutable()
+{
+	if (!Array.IsUnique())
+	{
+		Array = MakeShared<TArray<FGESEventListener>, ESPMode::NotThreadSafe>(*Array);
+	}
+	return *Array;
+}
+
+void FGESListenerArray::Add(const FGESEventListener& Listener)
+{
+	Mutable().Add(Listener);
+}
+
+int32 FGESListenerArray::Remove(const FGESEventListener& Listener)
+{
+	//don't copy a pinned array just to find nothing
+	if (!Array->ContainsByPredicate([&Listener](const FGESEventListener& Existing)
+		{
+			return Existing.ReceiverWCO == Listener.ReceiverWCO && Existing.FunctionName == Listener.FunctionName;
+		}))
+	{
+		return 0;
+	}
+	return Mutable().Remove(Listener);
+}
+
+int32 FGESListenerArray::Num() const
+{
+	return Array->Num();
+}
+
 FGESEvent::FGESEvent()
 {
 	PinnedData = FGESPinnedData();
+	PinnedVersion = 0;
 }
 
 FGESPropertyEmitContext::FGESPropertyEmitContext()
@@ -50,7 +172,11 @@ FGESPropertyEmitContext::FGESPropertyEmitContext()
 	Property = nullptr;
 	PropertyPtr = nullptr;
 	SpecificTarget = nullptr;
+	EventKey = nullptr;
 	bHandleAllocation = false;
+	bLocated = false;
+	Location = FVector::ZeroVector;
+	Radius = 0.f;
 }
 
 FGESPropertyEmitContext::FGESPropertyEmitContext(const FGESEmitContext& Other)
@@ -63,6 +189,11 @@ FGESPropertyEmitContext::FGESPropertyEmitContext(const FGESEmitContext& Other)
 	Property = nullptr;
 	PropertyPtr = nullptr;
 	SpecificTarget = nullptr;
+	EventKey = nullptr;
+	bHandleAllocation = false;
+	bLocated = false;
+	Location = FVector::ZeroVector;
+	Radius = 0.f;
 }
 
 FGESEvent::FGESEvent(const FGESEmitContext& Other)
@@ -71,40 +202,161 @@ FGESEvent::FGESEvent(const FGESEmitContext& Other)
 	Event = Other.Event;
 	WorldContext = Other.WorldContext;
 	bPinned = Other.bPinned;
+	PinnedVersion = 0;
 }
 
 FGESMinimalEventListener::FGESMinimalEventListener()
 {
 	ReceiverWCO = nullptr;
-	FunctionName = TEXT("");
+	FunctionName = NAME_None;
 }
 
 FGESEventListener::FGESEventListener()
 {
 	FGESMinimalEventListener();
-	Function = nullptr;
-	bIsBoundToDelegate = false;
-	bIsBoundToLambda = false;
-	LambdaFunction = nullptr;
+	DeliveryPhase = EGESDeliveryPhase::Immediate;
+	bIsNativeFunction = false;
+	bFirstParamIsOut = false;
+	bIsOneShot = false;
+	bReceivesBatch = false;
+	bLoggedParamMismatch = false;
 }
 
 FGESEventListener::FGESEventListener(const FGESMinimalEventListener& Minimal)
 {
 	ReceiverWCO = Minimal.ReceiverWCO;
 	FunctionName = Minimal.FunctionName;
+	DeliveryPhase = EGESDeliveryPhase::Immediate;
+	bIsNativeFunction = false;
+	bFirstParamIsOut = false;
+	bIsOneShot = false;
+	bReceivesBatch = false;
+	bLoggedParamMismatch = false;
 }
 
 bool FGESEventListener::LinkFunction()
 {
-	Function = ReceiverWCO->FindFunction(FName(*FunctionName));
+	FGESFunctionTarget FunctionTarget;
+	FunctionTarget.Function = ReceiverWCO->FindFunction(FunctionName);
+	UFunction* Function = FunctionTarget.Function;
+
+	//params lead the function's property chain
+	FProperty* FirstParam = Function ? CastField<FProperty>(Function->ChildProperties) : nullptr;
+	FunctionTarget.FirstParam = (FirstParam && FirstParam->HasAnyPropertyFlags(CPF_Parm)) ? FirstParam : nullptr;
+
+	//Decide once whether the thunk can be called directly. Net functions need ProcessEvent for remote calls,
+	//return values or extra params wouldn't fit the single value buffer GES passes.
+	bIsNativeFunction = false;
+	bFirstParamIsOut = false;
+	if (Function &&
+		Function->HasAnyFunctionFlags(FUNC_Native) &&
+		!Function->HasAnyFunctionFlags(FUNC_Net) &&
+		Function->GetNativeFunc() != nullptr &&
+		Function->ReturnValueOffset == MAX_uint16 &&
+		Function->NumParms <= 1)
+	{
+		bIsNativeFunction = true;
+		bFirstParamIsOut = Function->NumParms == 1 && FunctionTarget.FirstParam && FunctionTarget.FirstParam->HasAnyPropertyFlags(CPF_OutParm);
+	}
+	Target.Set<FGESFunctionTarget>(FunctionTarget);
 	return IsValidListener();
 }
 
 bool FGESEventListener::IsValidListener() const
 {
-	return (Function != nullptr || 
-		bIsBoundToDelegate ||
-		(bIsBoundToLambda && LambdaFunction != nullptr));
+	switch (Kind())
+	{
+	case EGESListenerKind::Function:
+		return Target.Get<FGESFunctionTarget>().Function != nullptr;
+	case EGESListenerKind::Delegate:
+		return true;
+	default:
+		return (bool)Target.Get<FLambda>();
+	}
+}
+
+UFunction* FGESEventListener::GetFunction() const
+{
+	const FGESFunctionTarget* FunctionTarget = Target.TryGet<FGESFunctionTarget>();
+	return FunctionTarget ? FunctionTarget->Function : nullptr;
+}
+
+FProperty* FGESEventListener::GetFirstParam() const
+{
+	const FGESFunctionTarget* FunctionTarget = Target.TryGet<FGESFunctionTarget>();
+	return FunctionTarget ? FunctionTarget->FirstParam : nullptr;
+}
+
+FProperty* FGESEventListener::GetOutParam() const
+{
+	return bFirstParamIsOut ? GetFirstParam() : nullptr;
+}
+
+void FGESEventListener::BindLambda(FLambda InLambda)
+{
+	Target.Set<FLambda>(MoveTemp(InLambda));
+}
+
+void FGESEventListener::BindDelegate(const FGESOnePropertySignature& Delegate)
+{
+	Target.Set<FGESOnePropertySignature>(Delegate);
+}
+
+void FGESEventListener::CallWildcard(const FGESWildcardProperty& Data) const
+{
+	if (const FGESOnePropertySignature* Delegate = Target.TryGet<FGESOnePropertySignature>())
+	{
+		Delegate->ExecuteIfBound(Data);
+	}
+	else if (const FLambda* Lambda = Target.TryGet<FLambda>())
+	{
+		if (*Lambda)
+		{
+			(*Lambda)(Data);
+		}
+	}
+}
+
+FGESListenerExtras& FGESEventListener::MutableExtras()
+{
+	//setters run before the listener is added, a fresh copy keeps the listener it was copied from untouched
+	Extras = Extras.IsValid() ? MakeShared<FGESListenerExtras, ESPMode::NotThreadSafe>(*Extras) : MakeShared<FGESListenerExtras, ESPMode::NotThreadSafe>();
+	return *Extras;
+}
+
+void FGESEventListener::MakeOneShot()
+{
+	bIsOneShot = true;
+	MutableExtras().bOneShotDelivered = false;
+}
+
+bool FGESEventListener::IsOneShotDelivered() const
+{
+	return bIsOneShot && Extras->bOneShotDelivered;
+}
+
+void FGESEventListener::MarkOneShotDelivered() const
+{
+	Extras->bOneShotDelivered = true;
+}
+
+void FGESEventListener::SetPositionSource(USceneComponent* Source)
+{
+	if (!Source && !Extras.IsValid())
+	{
+		return;
+	}
+	MutableExtras().PositionSource = Source;
+}
+
+USceneComponent* FGESEventListener::GetPositionSource() const
+{
+	return Extras.IsValid() ? Extras->PositionSource.Get() : nullptr;
+}
+
+bool FGESEventListener::HasPositionSource() const
+{
+	return Extras.IsValid() && !Extras->PositionSource.IsExplicitlyNull();
 }
 
 
@@ -0,0 +1,292 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESIPCBridge.h"
+#include "GESHandler.h"
+#include "GESIPCRing.h"
+#include "GESPayloadCodec.h"
+#include "GlobalEventSystem.h"
+
+#define GES_IPC_SUPPORTED (PLATFORM_LINUX || PLATFORM_MAC)
+
+#if GES_IPC_SUPPORTED
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace
+{
+	//Ring indices, see GESIPCRing.h
+	constexpr int32 OutboundRing = 0;
+	constexpr int32 InboundRing = 1;
+
+	//Upper bound of injected messages handled per tick so a flood can't stall a frame
+	constexpr int32 MaxInjectedPerTick = 256;
+}
+
+FGESIPCBridge::FGESIPCBridge()
+{
+	SegmentBase = nullptr;
+	MappedSize = 0;
+	SegmentFd = -1;
+	bCreatedSegment = false;
+	bIsInjecting = false;
+}
+
+FGESIPCBridge::~FGESIPCBridge()
+{
+	Stop();
+}
+
+bool FGESIPCBridge::Start(const FGESIPCBridgeSettings& InSettings, TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext)
+{
+	if (IsRunning())
+	{
+		Stop();
+	}
+	if (!InHandler.IsValid())
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::Start No valid handler provided."));
+		return false;
+	}
+
+	Settings = InSettings;
+	Settings.RingCapacity = GESIPC::AlignRecord(FMath::Max<uint32>(Settings.RingCapacity, 1024));
+
+	if (!MapSegment())
+	{
+		return false;
+	}
+
+	Handler = InHandler;
+	WorldContext = InWorldContext;
+	EmitHandle = InHandler->OnEmit.AddRaw(this, &FGESIPCBridge::HandleEmit);
+
+	if (Settings.bAllowInjection)
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGESIPCBridge::Tick));
+	}
+
+	UE_LOG(LogGES, Log, TEXT("FGESIPCBridge::Start mirroring to %s (%d bytes per ring)."), *Settings.SegmentName, Settings.RingCapacity);
+	return true;
+}
+
+void FGESIPCBridge::Stop()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	TSharedPtr<FGESHandler> PinnedHandler = Handler.Pin();
+	if (PinnedHandler.IsValid() && EmitHandle.IsValid())
+	{
+		PinnedHandler->OnEmit.Remove(EmitHandle);
+	}
+	EmitHandle.Reset();
+	Handler.Reset();
+
+	UnmapSegment();
+}
+
+bool FGESIPCBridge::IsRunning() const
+{
+	return SegmentBase != nullptr;
+}
+
+uint64 FGESIPCBridge::GetDroppedCount() const
+{
+	if (!SegmentBase)
+	{
+		return 0;
+	}
+	GESIPC::FRing Ring = GESIPC::GetRing(SegmentBase, OutboundRing, Settings.RingCapacity);
+	return Ring.IsValid() ? Ring.GetDroppedRecords() : 0;
+}
+
+bool FGESIPCBridge::ShouldMirror(const FString& Domain) const
+{
+	if (Settings.MirroredDomains.Num() == 0)
+	{
+		return true;
+	}
+	for (const FString& Prefix : Settings.MirroredDomains)
+	{
+		//whole domain segments only, 'game' matches 'game' and 'game.score' but not 'gameplay'
+		if (Domain.StartsWith(Prefix, ESearchCase::CaseSensitive) &&
+			(Domain.Len() == Prefix.Len() || Domain[Prefix.Len()] == TEXT('.')))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FGESIPCBridge::HandleEmit(const FGESPropertyEmitContext& EmitData)
+{
+	if (bIsInjecting || !SegmentBase || !ShouldMirror(EmitData.Domain))
+	{
+		return;
+	}
+
+	ScratchBuffer.Reset();
+	FGESPayloadCodec::EncodeMessage(EmitData, ScratchBuffer);
+
+	//non-blocking, drops if the reader fell behind
+	GESIPC::FRing Ring = GESIPC::GetRing(SegmentBase, OutboundRing, Settings.RingCapacity);
+	if (!Ring.IsValid())
+	{
+		return;
+	}
+	Ring.TryWrite(ScratchBuffer.GetData(), (uint32)ScratchBuffer.Num());
+}
+
+bool FGESIPCBridge::Tick(float DeltaTime)
+{
+	if (!SegmentBase)
+	{
+		return true;
+	}
+
+	//the segment is writable by any process that opens it, don't read through a header that no longer matches
+	GESIPC::FRing Ring = GESIPC::GetRing(SegmentBase, InboundRing, Settings.RingCapacity);
+	if (!Ring.IsValid())
+	{
+		return true;
+	}
+
+	bool bCorrupt = false;
+	for (int32 i = 0; i < MaxInjectedPerTick; i++)
+	{
+		bool bDidRead = Ring.TryRead([this](const uint8_t* Data, uint32_t Num)
+		{
+			InjectMessage(Data, Num);
+		}, &bCorrupt);
+		if (!bDidRead)
+		{
+			break;
+		}
+	}
+	if (bCorrupt)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::Tick inbound ring of %s held a malformed record, pending messages discarded."), *Settings.SegmentName);
+	}
+	return true;
+}
+
+void FGESIPCBridge::InjectMessage(const uint8* Data, uint32 Num)
+{
+	TSharedPtr<FGESHandler> PinnedHandler = Handler.Pin();
+	if (!PinnedHandler.IsValid() || !WorldContext.IsValid())
+	{
+		return;
+	}
+
+	GESWire::FReader Reader(Data, Num);
+	FGESEmitContext Context;
+	FGESDecodedPayload Payload;
+	if (!FGESPayloadCodec::DecodeMessage(Reader, Context, Payload))
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::InjectMessage malformed message (%d bytes) skipped."), Num);
+		return;
+	}
+	Context.WorldContext = WorldContext.Get();
+
+	bIsInjecting = true;
+	FGESPayloadCodec::EmitDecodedPayload(*PinnedHandler, Context, Payload);
+	bIsInjecting = false;
+}
+
+#if GES_IPC_SUPPORTED
+
+bool FGESIPCBridge::MapSegment()
+{
+	const uint64 Size = GESIPC::SegmentSize(Settings.RingCapacity);
+
+	//only size a segment we created, an existing one may already be mapped by a reader
+	SegmentFd = shm_open(TCHAR_TO_UTF8(*Settings.SegmentName), O_CREAT | O_EXCL | O_RDWR, 0660);
+	bCreatedSegment = SegmentFd >= 0;
+	if (!bCreatedSegment && errno == EEXIST)
+	{
+		SegmentFd = shm_open(TCHAR_TO_UTF8(*Settings.SegmentName), O_RDWR, 0660);
+	}
+	if (SegmentFd < 0)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::MapSegment shm_open failed for %s (errno %d)."), *Settings.SegmentName, errno);
+		return false;
+	}
+
+	if (bCreatedSegment)
+	{
+		if (ftruncate(SegmentFd, (off_t)Size) != 0)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::MapSegment ftruncate failed for %s (errno %d)."), *Settings.SegmentName, errno);
+			UnmapSegment();
+			return false;
+		}
+	}
+	else
+	{
+		struct stat Stat;
+		if (fstat(SegmentFd, &Stat) != 0 || (uint64)Stat.st_size != Size)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::MapSegment %s already exists with a different size, use the same RingCapacity as its creator or remove it."), *Settings.SegmentName);
+			UnmapSegment();
+			return false;
+		}
+	}
+
+	void* Mapped = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, SegmentFd, 0);
+	if (Mapped == MAP_FAILED)
+	{
+		UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::MapSegment mmap failed for %s (errno %d)."), *Settings.SegmentName, errno);
+		UnmapSegment();
+		return false;
+	}
+
+	SegmentBase = Mapped;
+	MappedSize = Size;
+	GESIPC::InitializeSegment(SegmentBase, Settings.RingCapacity);
+	return true;
+}
+
+void FGESIPCBridge::UnmapSegment()
+{
+	if (SegmentBase)
+	{
+		munmap(SegmentBase, MappedSize);
+		SegmentBase = nullptr;
+		MappedSize = 0;
+	}
+	if (SegmentFd >= 0)
+	{
+		close(SegmentFd);
+		SegmentFd = -1;
+	}
+
+	//readers keep their mapping, the name goes away with the process that created it
+	if (bCreatedSegment)
+	{
+		shm_unlink(TCHAR_TO_UTF8(*Settings.SegmentName));
+		bCreatedSegment = false;
+	}
+}
+
+#else
+
+bool FGESIPCBridge::MapSegment()
+{
+	UE_LOG(LogGES, Warning, TEXT("FGESIPCBridge::MapSegment shared memory bridge is not supported on this platform."));
+	return false;
+}
+
+void FGESIPCBridge::UnmapSegment()
+{
+	SegmentBase = nullptr;
+	MappedSize = 0;
+}
+
+#endif
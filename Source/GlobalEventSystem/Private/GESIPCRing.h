@@ -0,0 +1,227 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+/**
+* Lock-free single producer / single consumer byte ring living in shared memory.
+* Plain C++ so the standalone reader in Extras/GESIPCReader can use the same layout.
+*
+* A segment holds two rings: Outbound (game -> external) and Inbound (external -> game).
+* Each record is a u32 size followed by the bytes, padded to 4 bytes. A size of WrapMarker
+* means the writer skipped the remaining tail of the ring and continued at the start.
+* Writers never block, a record that doesn't fit is dropped and counted.
+* Readers don't trust the other side: cursors and sizes that don't describe a record inside the
+* ring are treated as corruption and everything pending is discarded.
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace GESIPC
+{
+	static constexpr uint32_t SegmentMagic = 0x49534547;	//'GESI'
+	static constexpr uint32_t SegmentVersion = 1;
+	static constexpr uint32_t WrapMarker = 0xFFFFFFFFu;
+
+	struct alignas(64) FRingHeader
+	{
+		//monotonic byte cursors, position in ring is Cursor % Capacity
+		alignas(64) std::atomic<uint64_t> WriteCursor;
+		alignas(64) std::atomic<uint64_t> ReadCursor;
+		std::atomic<uint64_t> DroppedRecords;
+	};
+
+	struct alignas(64) FSegmentHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t Capacity;	//data bytes per ring, multiple of 4
+		uint32_t Reserved;
+	};
+
+	inline uint32_t AlignRecord(uint32_t Size)
+	{
+		return (Size + 3u) & ~3u;
+	}
+
+	inline uint64_t RingStride(uint32_t Capacity)
+	{
+		return sizeof(FRingHeader) + (uint64_t)Capacity;
+	}
+
+	inline uint64_t SegmentSize(uint32_t Capacity)
+	{
+		return sizeof(FSegmentHeader) + 2 * RingStride(Capacity);
+	}
+
+	class FRing
+	{
+	public:
+		FRing()
+			: Header(nullptr)
+			, Data(nullptr)
+			, Capacity(0)
+		{
+		}
+
+		FRing(void* RingBase, uint32_t InCapacity)
+			: Header((FRingHeader*)RingBase)
+			, Data((uint8_t*)RingBase + sizeof(FRingHeader))
+			, Capacity(InCapacity)
+		{
+		}
+
+		bool IsValid() const
+		{
+			return Header != nullptr;
+		}
+
+		/** Producer side. Returns false (and counts a drop) if the record doesn't fit right now. */
+		bool TryWrite(const void* Bytes, uint32_t Num)
+		{
+			const uint32_t RecordSize = AlignRecord(Num + sizeof(uint32_t));
+			const uint64_t Write = Header->WriteCursor.load(std::memory_order_relaxed);
+			const uint64_t Read = Header->ReadCursor.load(std::memory_order_acquire);
+			const uint64_t Free = Capacity - (Write - Read);
+
+			const uint32_t Position = (uint32_t)(Write % Capacity);
+			const uint32_t Tail = Capacity - Position;
+
+			//need the record contiguous, skipping the tail if it doesn't fit there
+			const uint64_t Needed = (RecordSize <= Tail) ? RecordSize : (uint64_t)Tail + RecordSize;
+			if (RecordSize > Capacity || Needed > Free)
+			{
+				Header->DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			uint64_t Cursor = Write;
+			if (RecordSize > Tail)
+			{
+				memcpy(Data + Position, &WrapMarker, sizeof(uint32_t));
+				Cursor += Tail;
+			}
+
+			uint8_t* Record = Data + (uint32_t)(Cursor % Capacity);
+			memcpy(Record, &Num, sizeof(uint32_t));
+			memcpy(Record + sizeof(uint32_t), Bytes, Num);
+
+			Header->WriteCursor.store(Cursor + RecordSize, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		* Consumer side. Calls Consume(const uint8_t* Bytes, uint32_t Num) for the next record, if any.
+		* A record that doesn't fit the ring skips the reader to the write cursor, returns false and sets OutCorrupt.
+		*/
+		template<typename ConsumeType>
+		bool TryRead(ConsumeType&& Consume, bool* OutCorrupt = nullptr)
+		{
+			uint64_t Read = Header->ReadCursor.load(std::memory_order_relaxed);
+			const uint64_t Write = Header->WriteCursor.load(std::memory_order_acquire);
+			if (Read == Write)
+			{
+				return false;
+			}
+
+			//cursors are only ever advanced by whole records
+			uint64_t Pending = Write - Read;
+			if (Pending > Capacity || (Read % sizeof(uint32_t)) != 0)
+			{
+				return Discard(Write, OutCorrupt);
+			}
+
+			uint32_t Position = (uint32_t)(Read % Capacity);
+			uint32_t Num = 0;
+			memcpy(&Num, Data + Position, sizeof(uint32_t));
+			if (Num == WrapMarker)
+			{
+				//the marker is followed by a record at the start
+				const uint32_t Tail = Capacity - Position;
+				if (Tail >= Pending)
+				{
+					return Discard(Write, OutCorrupt);
+				}
+				Read += Tail;
+				Pending -= Tail;
+				Position = 0;
+				memcpy(&Num, Data, sizeof(uint32_t));
+			}
+
+			if (Num > Capacity - Position - sizeof(uint32_t) || AlignRecord(Num + sizeof(uint32_t)) > Pending)
+			{
+				return Discard(Write, OutCorrupt);
+			}
+
+			Consume((const uint8_t*)(Data + Position + sizeof(uint32_t)), Num);
+
+			Header->ReadCursor.store(Read + AlignRecord(Num + sizeof(uint32_t)), std::memory_order_release);
+			return true;
+		}
+
+		uint64_t GetDroppedRecords() const
+		{
+			return Header->DroppedRecords.load(std::memory_order_relaxed);
+		}
+
+	private:
+		bool Discard(uint64_t Write, bool* OutCorrupt)
+		{
+			Header->ReadCursor.store(Write, std::memory_order_release);
+			if (OutCorrupt)
+			{
+				*OutCorrupt = true;
+			}
+			return false;
+		}
+
+		FRingHeader* Header;
+		uint8_t* Data;
+		uint32_t Capacity;
+	};
+
+	/** Writes a fresh header and empty rings if the segment isn't already initialized with this layout. */
+	inline bool InitializeSegment(void* SegmentBase, uint32_t Capacity)
+	{
+		FSegmentHeader* Segment = (FSegmentHeader*)SegmentBase;
+		if (Segment->Magic == SegmentMagic && Segment->Version == SegmentVersion && Segment->Capacity == Capacity)
+		{
+			return false;
+		}
+		for (int32_t RingIndex = 0; RingIndex < 2; RingIndex++)
+		{
+			uint8_t* RingBase = (uint8_t*)SegmentBase + sizeof(FSegmentHeader) + RingIndex * RingStride(Capacity);
+			FRingHeader* Header = new (RingBase) FRingHeader();
+			Header->WriteCursor.store(0);
+			Header->ReadCursor.store(0);
+			Header->DroppedRecords.store(0);
+		}
+		Segment->Capacity = Capacity;
+		Segment->Version = SegmentVersion;
+		Segment->Reserved = 0;
+		std::atomic_thread_fence(std::memory_order_release);
+		Segment->Magic = SegmentMagic;
+		return true;
+	}
+
+	/**
+	* Ring 0 is outbound (game -> external), ring 1 inbound (external -> game). Pass the capacity the segment was
+	* mapped with as ExpectedCapacity to reject a header rewritten by the other side.
+	*/
+	inline FRing GetRing(void* SegmentBase, int32_t RingIndex, uint32_t ExpectedCapacity = 0)
+	{
+		FSegmentHeader* Segment = (FSegmentHeader*)SegmentBase;
+		if (Segment->Magic != SegmentMagic || Segment->Version != SegmentVersion)
+		{
+			return FRing();
+		}
+		if ((ExpectedCapacity != 0 && Segment->Capacity != ExpectedCapacity) || Segment->Capacity < 2 * sizeof(uint32_t) || (Segment->Capacity % sizeof(uint32_t)) != 0)
+		{
+			return FRing();
+		}
+		uint8_t* RingBase = (uint8_t*)SegmentBase + sizeof(FSegmentHeader) + RingIndex * RingStride(Segment->Capacity);
+		return FRing(RingBase, Segment->Capacity);
+	}
+}
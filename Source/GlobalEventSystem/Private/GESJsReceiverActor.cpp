@@ -0,0 +1,164 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESJsReceiverActor.h"
+#include "GESHandler.h"
+#include "GlobalEventSystem.h"
+
+AGESJsReceiverActor::AGESJsReceiverActor()
+{
+	//only ticks while there is a batch or unbinds to process
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	bBatchEvents = false;
+	NextBindId = 0;
+}
+
+int32 AGESJsReceiverActor::JsBind(const FString& Domain, const FString& Event)
+{
+	const int32 BindId = NextBindId++;
+
+	FJsBinding Binding;
+	Binding.Context.Domain = Domain;
+	Binding.Context.Event = Event;
+	Binding.Context.WorldContext = this;
+
+	TWeakObjectPtr<AGESJsReceiverActor> WeakThis = this;
+	Binding.LambdaName = FGESHandler::ForDomain(Domain, this)->AddLambdaListener(Binding.Context, [WeakThis, BindId](const FGESWildcardProperty& WildcardProperty)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->HandleEvent(BindId, WildcardProperty);
+		}
+	});
+
+	Bindings.Add(BindId, Binding);
+	return BindId;
+}
+
+bool AGESJsReceiverActor::JsUnbind(int32 BindId)
+{
+	FJsBinding Binding;
+	if (!Bindings.RemoveAndCopyValue(BindId, Binding))
+	{
+		UE_LOG(LogGES, Warning, TEXT("AGESJsReceiverActor::JsUnbind bind id %d is not bound."), BindId);
+		return false;
+	}
+
+	//events for this id are ignored from here on, the listener itself is removed on tick
+	PendingUnbinds.Add(Binding);
+	SetActorTickEnabled(true);
+	return true;
+}
+
+void AGESJsReceiverActor::JsUnbindAll()
+{
+	for (TPair<int32, FJsBinding>& Pair : Bindings)
+	{
+		PendingUnbinds.Add(Pair.Value);
+	}
+	Bindings.Empty();
+	PendingBatch.Reset();
+
+	if (PendingUnbinds.Num() > 0)
+	{
+		SetActorTickEnabled(true);
+	}
+}
+
+void AGESJsReceiverActor::JsEmitString(const FString& Domain, const FString& Event, const FString& Value, bool bPinned)
+{
+	FGESEmitContext Context;
+	Context.Domain = Domain;
+	Context.Event = Event;
+	Context.bPinned = bPinned;
+	Context.WorldContext = this;
+	FGESHandler::ForDomain(Domain, this)->EmitEvent(Context, Value);
+}
+
+void AGESJsReceiverActor::JsEmitObject(const FString& Domain, const FString& Event, UObject* Value, bool bPinned)
+{
+	FGESEmitContext Context;
+	Context.Domain = Domain;
+	Context.Event = Event;
+	Context.bPinned = bPinned;
+	Context.WorldContext = this;
+	FGESHandler::ForDomain(Domain, this)->EmitEvent(Context, Value);
+}
+
+void AGESJsReceiverActor::HandleEvent(int32 BindId, const FGESWildcardProperty& WildcardProperty)
+{
+	if (!Bindings.Contains(BindId))
+	{
+		return;
+	}
+
+	FGESJsEvent JsEvent;
+	JsEvent.BindId = BindId;
+
+	FProperty* Property = WildcardProperty.Property.Get();
+	if (Property && WildcardProperty.PropertyPtr)
+	{
+		if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+		{
+			JsEvent.StringValue = StrProperty->GetPropertyValue(WildcardProperty.PropertyPtr);
+		}
+		else if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+		{
+			JsEvent.ObjectValue = ObjectProperty->GetObjectPropertyValue(WildcardProperty.PropertyPtr);
+		}
+		else
+		{
+			Property->ExportTextItem_Direct(JsEvent.StringValue, WildcardProperty.PropertyPtr, nullptr, nullptr, PPF_None);
+		}
+	}
+
+	if (bBatchEvents)
+	{
+		PendingBatch.Add(MoveTemp(JsEvent));
+		SetActorTickEnabled(true);
+	}
+	else
+	{
+		OnJsDispatch(JsEvent.BindId, JsEvent.StringValue, JsEvent.ObjectValue);
+	}
+}
+
+void AGESJsReceiverActor::RemovePendingUnbinds()
+{
+	for (const FJsBinding& Binding : PendingUnbinds)
+	{
+		TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Binding.Context.Domain, this);
+		if (Handler.IsValid())
+		{
+			Handler->RemoveLambdaListener(Binding.Context, Binding.LambdaName);
+		}
+	}
+	PendingUnbinds.Reset();
+}
+
+void AGESJsReceiverActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (PendingBatch.Num() > 0)
+	{
+		//events received during the dispatch go into the next batch
+		Swap(PendingBatch, DeliveringBatch);
+		OnJsDispatchBatch(DeliveringBatch);
+		DeliveringBatch.Reset();
+	}
+
+	RemovePendingUnbinds();
+
+	if (PendingBatch.Num() == 0)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void AGESJsReceiverActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	JsUnbindAll();
+	RemovePendingUnbinds();
+	Super::EndPlay(EndPlayReason);
+}
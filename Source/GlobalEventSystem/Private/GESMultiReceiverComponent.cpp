@@ -0,0 +1,130 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESMultiReceiverComponent.h"
+#include "GESHandler.h"
+#include "GlobalEventSystem.h"
+#include "GameFramework/Actor.h"
+
+UGESMultiReceiverComponent::UGESMultiReceiverComponent(const FObjectInitializer& init) : UActorComponent(init)
+{
+	bBindOnBeginPlay = true;
+	bUnbindOnEndPlay = true;
+	bIsBound = false;
+}
+
+void UGESMultiReceiverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (bBindOnBeginPlay)
+	{
+		BindAll();
+	}
+}
+
+void UGESMultiReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bUnbindOnEndPlay)
+	{
+		UnbindAll();
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGESMultiReceiverComponent::BindAll()
+{
+	UnbindAll();
+
+	UObject* Owner = GetOwner();
+
+	TArray<FGESListenerBind> ListenerBinds;
+	ListenerBinds.Reserve(Binds.Num());
+
+	TWeakObjectPtr<UGESMultiReceiverComponent> WeakThis = this;
+
+	for (int32 BindIndex = 0; BindIndex < Binds.Num(); BindIndex++)
+	{
+		const FGESNameBind& Bind = Binds[BindIndex];
+
+		FGESListenerBind& ListenerBind = ListenerBinds.AddDefaulted_GetRef();
+		ListenerBind.Domain = Bind.Domain;
+		ListenerBind.Event = Bind.Event;
+		ListenerBind.Listener.DeliveryPhase = Bind.DeliveryPhase;
+		if (Bind.bListenAtOwnerLocation && Owner)
+		{
+			ListenerBind.Listener.SetPositionSource(GetOwner()->GetRootComponent());
+		}
+
+		if (!Bind.ReceivingFunction.IsEmpty())
+		{
+			//a plain function listener on the owner, same as GESBindEvent
+			ListenerBind.Listener.ReceiverWCO = Owner;
+			ListenerBind.Listener.FunctionName = FName(*Bind.ReceivingFunction);
+			if (!Owner || !ListenerBind.Listener.LinkFunction())
+			{
+				UE_LOG(LogGES, Warning, TEXT("UGESMultiReceiverComponent::BindAll %s does not have the function '%s'. Bind to %s.%s skipped."),
+					Owner ? *Owner->GetName() : TEXT("(no owner)"), *Bind.ReceivingFunction, *Bind.Domain, *Bind.Event);
+				ListenerBinds.Pop();
+				continue;
+			}
+
+			//owner listeners aren't indexed under this component, remember them for UnbindAll
+			FGESEventListenerWithContext& FunctionBind = FunctionBinds.AddDefaulted_GetRef();
+			FunctionBind.Listener = ListenerBind.Listener;
+			FunctionBind.Domain = Bind.Domain;
+			FunctionBind.Event = Bind.Event;
+			continue;
+		}
+
+		ListenerBind.Listener.ReceiverWCO = this;
+		ListenerBind.Listener.FunctionName = FName(*(GetName() + TEXT(".bind")), BindIndex + 1);
+		ListenerBind.Listener.BindLambda([WeakThis, BindIndex](const FGESWildcardProperty& WildcardProperty)
+		{
+			if (WeakThis.IsValid() && WeakThis->OnEvent.IsBound())
+			{
+				WeakThis->OnEvent.Broadcast(BindIndex, WildcardProperty);
+			}
+		});
+	}
+
+	//flag before adding, pinned events are delivered during the add
+	bIsBound = true;
+
+	//binds can span buses, each bus gets its own batch
+	TMap<FGESHandler*, TArray<FGESListenerBind>> BindsByBus;
+	for (FGESListenerBind& ListenerBind : ListenerBinds)
+	{
+		BindsByBus.FindOrAdd(FGESHandler::ForDomain(ListenerBind.Domain, this).Get()).Add(MoveTemp(ListenerBind));
+	}
+	for (TPair<FGESHandler*, TArray<FGESListenerBind>>& Pair : BindsByBus)
+	{
+		Pair.Key->AddListeners(Pair.Value);
+	}
+}
+
+void UGESMultiReceiverComponent::UnbindAll()
+{
+	if (!bIsBound)
+	{
+		return;
+	}
+	FGESHandler::ForEachHandler([this](FGESHandler& Handler)
+	{
+		Handler.RemoveAllListenersForReceiver(this, false);
+	});
+	TSharedPtr<FGESHandler> ScopedBus = FGESHandler::FindScope(this);
+	if (ScopedBus.IsValid())
+	{
+		ScopedBus->RemoveAllListenersForReceiver(this, false);
+	}
+
+	for (const FGESEventListenerWithContext& FunctionBind : FunctionBinds)
+	{
+		TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(FunctionBind.Domain, this);
+		if (Handler.IsValid())
+		{
+			Handler->RemoveListener(FunctionBind.Domain, FunctionBind.Event, FGESEventListener(FunctionBind.Listener));
+		}
+	}
+	FunctionBinds.Reset();
+	bIsBound = false;
+}
@@ -0,0 +1,720 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESPayloadCodec.h"
+#include "GESHandler.h"
+#include "GlobalEventSystem.h"
+#include "GlobalEventSystemBPLibrary.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/StructuredArchive.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+using GESWire::EPayloadType;
+
+namespace
+{
+	//descriptors can arrive from other processes, keep what they can make us build bounded
+	constexpr int32 MaxDescriptorDepth = 4;
+	constexpr int32 MaxDescribedProperties = 256;
+
+	TMap<FString, FProperty*> DescribedProperties;
+
+	void AppendBlob(TArray<uint8>& OutBytes, const TArray<uint8>& Blob)
+	{
+		FGESPayloadCodec::AppendValue<uint32>(OutBytes, (uint32)Blob.Num());
+		OutBytes.Append(Blob);
+	}
+
+	//whether the payload tag of Property already names its exact type
+	bool IsImpliedByTag(FProperty* Property)
+	{
+		if (FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+		{
+			return ByteProperty->Enum == nullptr;
+		}
+		if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+		{
+			return ObjectProperty->PropertyClass == UObject::StaticClass();
+		}
+		return Property->IsA<FBoolProperty>() || Property->IsA<FIntProperty>() || Property->IsA<FFloatProperty>() ||
+			Property->IsA<FDoubleProperty>() || Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() ||
+			Property->IsA<FStructProperty>();
+	}
+
+	struct FDescriptorNode
+	{
+		FString Name;
+		TArray<FDescriptorNode> Args;
+	};
+
+	bool ParseDescriptor(const FString& Text, int32& Index, FDescriptorNode& OutNode, int32 Depth)
+	{
+		if (Depth > MaxDescriptorDepth)
+		{
+			return false;
+		}
+
+		const int32 Start = Index;
+		while (Index < Text.Len() && Text[Index] != TEXT('<') && Text[Index] != TEXT(',') && Text[Index] != TEXT('>'))
+		{
+			Index++;
+		}
+		OutNode.Name = Text.Mid(Start, Index - Start);
+		if (OutNode.Name.IsEmpty())
+		{
+			return false;
+		}
+
+		if (Index < Text.Len() && Text[Index] == TEXT('<'))
+		{
+			Index++;
+			for (;;)
+			{
+				if (!ParseDescriptor(Text, Index, OutNode.Args.AddDefaulted_GetRef(), Depth + 1))
+				{
+					return false;
+				}
+				if (Index < Text.Len() && Text[Index] == TEXT(','))
+				{
+					Index++;
+					continue;
+				}
+				break;
+			}
+			if (Index >= Text.Len() || Text[Index] != TEXT('>'))
+			{
+				return false;
+			}
+			Index++;
+		}
+		return true;
+	}
+
+	template<typename TObjectType>
+	TObjectType* FindDescribedType(const FDescriptorNode& Node)
+	{
+		//type paths are leaves
+		if (Node.Args.Num() != 1 || Node.Args[0].Args.Num() != 0)
+		{
+			return nullptr;
+		}
+		return FindObject<TObjectType>(nullptr, *Node.Args[0].Name);
+	}
+
+	//children are attached to Owner by their constructor
+	FProperty* NewDescribedProperty(const FDescriptorNode& Node, FFieldVariant Owner, const FName& Name)
+	{
+		const EObjectFlags Flags = EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted;
+		const FString& Type = Node.Name;
+
+		if (Node.Args.Num() == 0)
+		{
+			if (Type == TEXT("bool"))
+			{
+				FBoolProperty* Property = new FBoolProperty(Owner, Name, Flags);
+				Property->SetBoolSize(sizeof(bool), true);
+				return Property;
+			}
+			if (Type == TEXT("uint8"))	return new FByteProperty(Owner, Name, Flags);
+			if (Type == TEXT("int8"))	return new FInt8Property(Owner, Name, Flags);
+			if (Type == TEXT("int16"))	return new FInt16Property(Owner, Name, Flags);
+			if (Type == TEXT("int32"))	return new FIntProperty(Owner, Name, Flags);
+			if (Type == TEXT("int64"))	return new FInt64Property(Owner, Name, Flags);
+			if (Type == TEXT("uint16"))	return new FUInt16Property(Owner, Name, Flags);
+			if (Type == TEXT("uint32"))	return new FUInt32Property(Owner, Name, Flags);
+			if (Type == TEXT("uint64"))	return new FUInt64Property(Owner, Name, Flags);
+			if (Type == TEXT("float"))	return new FFloatProperty(Owner, Name, Flags);
+			if (Type == TEXT("double"))	return new FDoubleProperty(Owner, Name, Flags);
+			if (Type == TEXT("str"))	return new FStrProperty(Owner, Name, Flags);
+			if (Type == TEXT("name"))	return new FNameProperty(Owner, Name, Flags);
+			return nullptr;
+		}
+
+		if (Type == TEXT("object"))
+		{
+			UClass* Class = FindDescribedType<UClass>(Node);
+			if (!Class)
+			{
+				return nullptr;
+			}
+			FObjectProperty* Property = new FObjectProperty(Owner, Name, Flags);
+			Property->PropertyClass = Class;
+			return Property;
+		}
+		if (Type == TEXT("struct"))
+		{
+			UScriptStruct* Struct = FindDescribedType<UScriptStruct>(Node);
+			if (!Struct)
+			{
+				return nullptr;
+			}
+			FStructProperty* Property = new FStructProperty(Owner, Name, Flags);
+			Property->Struct = Struct;
+			return Property;
+		}
+		if (Type == TEXT("byte"))
+		{
+			UEnum* Enum = FindDescribedType<UEnum>(Node);
+			if (!Enum)
+			{
+				return nullptr;
+			}
+			FByteProperty* Property = new FByteProperty(Owner, Name, Flags);
+			Property->Enum = Enum;
+			return Property;
+		}
+		if (Type == TEXT("enum") && Node.Args.Num() == 2 && Node.Args[0].Args.Num() == 0)
+		{
+			UEnum* Enum = FindObject<UEnum>(nullptr, *Node.Args[0].Name);
+			if (!Enum)
+			{
+				return nullptr;
+			}
+			FEnumProperty* Property = new FEnumProperty(Owner, Name, Flags, Enum);
+			FProperty* Underlying = NewDescribedProperty(Node.Args[1], Property, TEXT("UnderlyingType"));
+			if (!Underlying || !Underlying->IsA<FNumericProperty>())
+			{
+				delete Property;
+				return nullptr;
+			}
+			return Property;
+		}
+		if (Type == TEXT("array") && Node.Args.Num() == 1)
+		{
+			FArrayProperty* Property = new FArrayProperty(Owner, Name, Flags);
+			if (!NewDescribedProperty(Node.Args[0], Property, TEXT("Inner")))
+			{
+				delete Property;
+				return nullptr;
+			}
+			return Property;
+		}
+		if (Type == TEXT("set") && Node.Args.Num() == 1)
+		{
+			FSetProperty* Property = new FSetProperty(Owner, Name, Flags);
+			if (!NewDescribedProperty(Node.Args[0], Property, TEXT("Element")))
+			{
+				delete Property;
+				return nullptr;
+			}
+			return Property;
+		}
+		if (Type == TEXT("map") && Node.Args.Num() == 2)
+		{
+			FMapProperty* Property = new FMapProperty(Owner, Name, Flags);
+			if (!NewDescribedProperty(Node.Args[0], Property, TEXT("Key")) ||
+				!NewDescribedProperty(Node.Args[1], Property, TEXT("Value")))
+			{
+				delete Property;
+				return nullptr;
+			}
+			return Property;
+		}
+		return nullptr;
+	}
+
+	//writes the decoded value into a value of Property, false if the payload doesn't fit it
+	bool FillDescribedValue(FProperty* Property, void* ValuePtr, const FGESDecodedPayload& Payload)
+	{
+		switch (Payload.Type)
+		{
+		case EPayloadType::Bool:
+			if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				BoolProperty->SetPropertyValue(ValuePtr, Payload.BoolValue);
+				return true;
+			}
+			return false;
+		case EPayloadType::Byte:
+		case EPayloadType::Int32:
+		case EPayloadType::Int64:
+		{
+			FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property);
+			FNumericProperty* NumericProperty = EnumProperty ? EnumProperty->GetUnderlyingProperty() : CastField<FNumericProperty>(Property);
+			if (NumericProperty && NumericProperty->IsInteger())
+			{
+				//unsigned 64 bit values were encoded bitwise as signed
+				NumericProperty->SetIntPropertyValue(ValuePtr, Payload.IntValue);
+				return true;
+			}
+			return false;
+		}
+		case EPayloadType::Float:
+		case EPayloadType::Double:
+		{
+			FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+			if (NumericProperty && NumericProperty->IsFloatingPoint())
+			{
+				NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Payload.FloatValue);
+				return true;
+			}
+			return false;
+		}
+		case EPayloadType::String:
+			if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+			{
+				StrProperty->SetPropertyValue(ValuePtr, Payload.StringValue);
+				return true;
+			}
+			return false;
+		case EPayloadType::Name:
+			if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+			{
+				NameProperty->SetPropertyValue(ValuePtr, FName(*Payload.StringValue));
+				return true;
+			}
+			return false;
+		case EPayloadType::Object:
+			if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				UObject* Object = Payload.StringValue.IsEmpty() ? nullptr : FindObject<UObject>(nullptr, *Payload.StringValue);
+				if (Object && !Object->IsA(ObjectProperty->PropertyClass))
+				{
+					return false;
+				}
+				ObjectProperty->SetObjectPropertyValue(ValuePtr, Object);
+				return true;
+			}
+			return false;
+		case EPayloadType::Struct:
+		case EPayloadType::Property:
+		{
+			FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (Payload.Type == EPayloadType::Struct && (!StructProperty || StructProperty->Struct->GetPathName() != Payload.StringValue))
+			{
+				return false;
+			}
+			FMemoryReader Reader(Payload.Blob);
+			//payloads can come from another process, only resolve objects that are already loaded
+			FObjectAndNameAsStringProxyArchive Ar(Reader, false);
+			if (StructProperty)
+			{
+				StructProperty->Struct->SerializeBin(Ar, ValuePtr);
+			}
+			else
+			{
+				Property->SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), ValuePtr, nullptr);
+			}
+			return !Ar.IsError();
+		}
+		default:
+			return false;
+		}
+	}
+
+	//value of OutPayload.Type, the tag has been read
+	bool DecodeValue(GESWire::FReader& Reader, FGESDecodedPayload& OutPayload)
+	{
+		switch (OutPayload.Type)
+		{
+		case EPayloadType::None:
+			return true;
+		case EPayloadType::Bool:
+		{
+			uint8 Value = 0;
+			Reader.Read(Value);
+			OutPayload.BoolValue = Value != 0;
+			break;
+		}
+		case EPayloadType::Byte:
+		{
+			uint8 Value = 0;
+			Reader.Read(Value);
+			OutPayload.IntValue = Value;
+			break;
+		}
+		case EPayloadType::Int32:
+		{
+			int32 Value = 0;
+			Reader.Read(Value);
+			OutPayload.IntValue = Value;
+			break;
+		}
+		case EPayloadType::Int64:
+			Reader.Read(OutPayload.IntValue);
+			break;
+		case EPayloadType::Float:
+		{
+			float Value = 0.f;
+			Reader.Read(Value);
+			OutPayload.FloatValue = Value;
+			break;
+		}
+		case EPayloadType::Double:
+			Reader.Read(OutPayload.FloatValue);
+			break;
+		case EPayloadType::String:
+		case EPayloadType::Name:
+		case EPayloadType::Object:
+			FGESPayloadCodec::DecodeString(Reader, OutPayload.StringValue);
+			break;
+		case EPayloadType::Struct:
+		case EPayloadType::Property:
+		{
+			const uint8_t* Bytes = nullptr;
+			uint32_t Num = 0;
+			if (FGESPayloadCodec::DecodeString(Reader, OutPayload.StringValue) && Reader.ReadSized(Bytes, Num))
+			{
+				OutPayload.Blob = TArray<uint8>(Bytes, Num);
+			}
+			break;
+		}
+		default:
+			return false;
+		}
+		return !Reader.bError;
+	}
+}
+
+void FGESPayloadCodec::EncodeString(const FString& String, TArray<uint8>& OutBytes)
+{
+	FTCHARToUTF8 Converter(*String);
+	AppendValue<uint32>(OutBytes, (uint32)Converter.Length());
+	OutBytes.Append((const uint8*)Converter.Get(), Converter.Length());
+}
+
+bool FGESPayloadCodec::DecodeString(GESWire::FReader& Reader, FString& OutString)
+{
+	const uint8_t* Bytes = nullptr;
+	uint32_t Num = 0;
+	if (!Reader.ReadSized(Bytes, Num))
+	{
+		return false;
+	}
+	FUTF8ToTCHAR Converter((const ANSICHAR*)Bytes, Num);
+	OutString = FString(Converter.Length(), Converter.Get());
+	return true;
+}
+
+void FGESPayloadCodec::EncodePayload(FProperty* Property, const void* PropertyPtr, TArray<uint8>& OutBytes)
+{
+	if (Property == nullptr || PropertyPtr == nullptr)
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::None);
+		return;
+	}
+
+	//the inner payload follows as usual, readers that don't care about the exact type just skip the descriptor
+	if (!IsImpliedByTag(Property))
+	{
+		const FString Descriptor = DescribeProperty(Property);
+		if (!Descriptor.IsEmpty())
+		{
+			AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Typed);
+			EncodeString(Descriptor, OutBytes);
+		}
+	}
+
+	if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Bool);
+		AppendValue<uint8>(OutBytes, BoolProperty->GetPropertyValue(PropertyPtr) ? 1 : 0);
+	}
+	else if (Property->IsA<FFloatProperty>())
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Float);
+		AppendValue<float>(OutBytes, *(const float*)PropertyPtr);
+	}
+	else if (Property->IsA<FDoubleProperty>())
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Double);
+		AppendValue<double>(OutBytes, *(const double*)PropertyPtr);
+	}
+	else if (Property->IsA<FIntProperty>())
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Int32);
+		AppendValue<int32>(OutBytes, *(const int32*)PropertyPtr);
+	}
+	else if (FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		AppendValue<uint8>(OutBytes, (uint8)(ByteProperty->Enum ? EPayloadType::Int64 : EPayloadType::Byte));
+		if (ByteProperty->Enum)
+		{
+			AppendValue<int64>(OutBytes, *(const uint8*)PropertyPtr);
+		}
+		else
+		{
+			AppendValue<uint8>(OutBytes, *(const uint8*)PropertyPtr);
+		}
+	}
+	else if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		//remaining integer widths
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Int64);
+		AppendValue<int64>(OutBytes, NumericProperty->GetSignedIntPropertyValue(PropertyPtr));
+	}
+	else if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::String);
+		EncodeString(StrProperty->GetPropertyValue(PropertyPtr), OutBytes);
+	}
+	else if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Name);
+		EncodeString(NameProperty->GetPropertyValue(PropertyPtr).ToString(), OutBytes);
+	}
+	else if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+	{
+		UObject* Object = ObjectProperty->GetObjectPropertyValue(PropertyPtr);
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Object);
+		EncodeString(Object ? Object->GetPathName() : FString(), OutBytes);
+	}
+	else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		TArray<uint8> Blob;
+		FMemoryWriter Writer(Blob);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		StructProperty->Struct->SerializeBin(Ar, const_cast<void*>(PropertyPtr));
+
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Struct);
+		EncodeString(StructProperty->Struct->GetPathName(), OutBytes);
+		AppendBlob(OutBytes, Blob);
+	}
+	else
+	{
+		//Containers etc, serialized through the property itself
+		TArray<uint8> Blob;
+		FMemoryWriter Writer(Blob);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		Property->SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), const_cast<void*>(PropertyPtr), nullptr);
+
+		AppendValue<uint8>(OutBytes, (uint8)EPayloadType::Property);
+		EncodeString(Property->GetCPPType(), OutBytes);
+		AppendBlob(OutBytes, Blob);
+	}
+}
+
+bool FGESPayloadCodec::DecodePayload(GESWire::FReader& Reader, FGESDecodedPayload& OutPayload)
+{
+	uint8 TypeByte = 0;
+	if (!Reader.Read(TypeByte))
+	{
+		return false;
+	}
+	OutPayload.Type = (EPayloadType)TypeByte;
+
+	if (OutPayload.Type == EPayloadType::Typed)
+	{
+		if (!DecodeString(Reader, OutPayload.TypeDescriptor) || !Reader.Read(TypeByte) || (EPayloadType)TypeByte == EPayloadType::Typed)
+		{
+			return false;
+		}
+		OutPayload.Type = (EPayloadType)TypeByte;
+	}
+	return DecodeValue(Reader, OutPayload);
+}
+
+void FGESPayloadCodec::EncodeMessage(const FGESPropertyEmitContext& EmitData, TArray<uint8>& OutBytes)
+{
+	EncodeString(EmitData.Domain, OutBytes);
+	EncodeString(EmitData.Event, OutBytes);
+	AppendValue<uint8>(OutBytes, EmitData.bPinned ? 1 : 0);
+	EncodePayload(EmitData.Property, EmitData.PropertyPtr, OutBytes);
+}
+
+bool FGESPayloadCodec::DecodeMessage(GESWire::FReader& Reader, FGESEmitContext& OutContext, FGESDecodedPayload& OutPayload)
+{
+	uint8 Pinned = 0;
+	if (!DecodeString(Reader, OutContext.Domain) ||
+		!DecodeString(Reader, OutContext.Event) ||
+		!Reader.Read(Pinned))
+	{
+		return false;
+	}
+	OutContext.bPinned = Pinned != 0;
+	return DecodePayload(Reader, OutPayload);
+}
+
+bool FGESPayloadCodec::EmitDecodedPayload(FGESHandler& Handler, const FGESEmitContext& EmitData, const FGESDecodedPayload& Payload)
+{
+	//plain tags other than the ones below imply their type, version 1 recordings have no descriptors
+	FString Descriptor = Payload.TypeDescriptor;
+	if (Descriptor.IsEmpty())
+	{
+		switch (Payload.Type)
+		{
+		case EPayloadType::Byte:
+			Descriptor = TEXT("uint8");
+			break;
+		case EPayloadType::Int64:
+			Descriptor = TEXT("int64");
+			break;
+		case EPayloadType::Double:
+			Descriptor = TEXT("double");
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (!Descriptor.IsEmpty())
+	{
+		FProperty* Property = PropertyForDescriptor(Descriptor);
+		if (!Property)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESPayloadCodec::EmitDecodedPayload type %s not available for %s.%s, skipped."), *Descriptor, *EmitData.Domain, *EmitData.Event);
+			return false;
+		}
+
+		void* ValuePtr = FMemory::Malloc(FMath::Max(Property->GetSize(), 1), Property->GetMinAlignment());
+		Property->InitializeValue(ValuePtr);
+		const bool bFilled = FillDescribedValue(Property, ValuePtr, Payload);
+		if (bFilled)
+		{
+			Handler.EmitEvent(EmitData, Property, ValuePtr);
+		}
+		else
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESPayloadCodec::EmitDecodedPayload payload for %s.%s doesn't match its type %s, skipped."), *EmitData.Domain, *EmitData.Event, *Descriptor);
+		}
+		Property->DestroyValue(ValuePtr);
+		FMemory::Free(ValuePtr);
+		return bFilled;
+	}
+
+	switch (Payload.Type)
+	{
+	case EPayloadType::None:
+		return Handler.EmitEvent(EmitData);
+	case EPayloadType::Bool:
+		Handler.EmitEvent(EmitData, Payload.BoolValue);
+		return true;
+	case EPayloadType::Int32:
+		Handler.EmitEvent(EmitData, (int32)Payload.IntValue);
+		return true;
+	case EPayloadType::Float:
+		Handler.EmitEvent(EmitData, (float)Payload.FloatValue);
+		return true;
+	case EPayloadType::String:
+		Handler.EmitEvent(EmitData, Payload.StringValue);
+		return true;
+	case EPayloadType::Name:
+		Handler.EmitEvent(EmitData, FName(*Payload.StringValue));
+		return true;
+	case EPayloadType::Object:
+	{
+		UObject* Object = Payload.StringValue.IsEmpty() ? nullptr : FindObject<UObject>(nullptr, *Payload.StringValue);
+		Handler.EmitEvent(EmitData, Object);
+		return true;
+	}
+	case EPayloadType::Struct:
+	{
+		UScriptStruct* Struct = FindObject<UScriptStruct>(nullptr, *Payload.StringValue);
+		if (!Struct)
+		{
+			UE_LOG(LogGES, Warning, TEXT("FGESPayloadCodec::EmitDecodedPayload struct %s not found for %s.%s, skipped."), *Payload.StringValue, *EmitData.Domain, *EmitData.Event);
+			return false;
+		}
+		void* StructPtr = FMemory::Malloc(FMath::Max(Struct->GetStructureSize(), 1), Struct->GetMinAlignment());
+		Struct->InitializeStruct(StructPtr);
+		{
+			FMemoryReader Reader(Payload.Blob);
+			FObjectAndNameAsStringProxyArchive Ar(Reader, false);
+			Struct->SerializeBin(Ar, StructPtr);
+		}
+		Handler.EmitEvent(EmitData, Struct, StructPtr);
+		Struct->DestroyStruct(StructPtr);
+		FMemory::Free(StructPtr);
+		return true;
+	}
+	default:
+		UE_LOG(LogGES, Warning, TEXT("FGESPayloadCodec::EmitDecodedPayload %s payload for %s.%s can't be re-emitted, skipped."), *Payload.StringValue, *EmitData.Domain, *EmitData.Event);
+		return false;
+	}
+}
+
+FString FGESPayloadCodec::DescribeProperty(FProperty* Property)
+{
+	if (!Property)
+	{
+		return FString();
+	}
+	if (Property->IsA<FBoolProperty>())		return TEXT("bool");
+	if (Property->IsA<FInt8Property>())		return TEXT("int8");
+	if (Property->IsA<FInt16Property>())	return TEXT("int16");
+	if (Property->IsA<FIntProperty>())		return TEXT("int32");
+	if (Property->IsA<FInt64Property>())	return TEXT("int64");
+	if (Property->IsA<FUInt16Property>())	return TEXT("uint16");
+	if (Property->IsA<FUInt32Property>())	return TEXT("uint32");
+	if (Property->IsA<FUInt64Property>())	return TEXT("uint64");
+	if (Property->IsA<FFloatProperty>())	return TEXT("float");
+	if (Property->IsA<FDoubleProperty>())	return TEXT("double");
+	if (Property->IsA<FStrProperty>())		return TEXT("str");
+	if (Property->IsA<FNameProperty>())		return TEXT("name");
+
+	if (FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		return ByteProperty->Enum ? TEXT("byte<") + ByteProperty->Enum->GetPathName() + TEXT(">") : TEXT("uint8");
+	}
+	if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		const FString Underlying = DescribeProperty(EnumProperty->GetUnderlyingProperty());
+		if (!EnumProperty->GetEnum() || Underlying.IsEmpty())
+		{
+			return FString();
+		}
+		return TEXT("enum<") + EnumProperty->GetEnum()->GetPathName() + TEXT(",") + Underlying + TEXT(">");
+	}
+	if (Property->GetClass() == FObjectProperty::StaticClass())
+	{
+		//plain hard references only, soft/weak/class references replay as UObject*
+		return TEXT("object<") + CastField<FObjectProperty>(Property)->PropertyClass->GetPathName() + TEXT(">");
+	}
+	if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		return TEXT("struct<") + StructProperty->Struct->GetPathName() + TEXT(">");
+	}
+	if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		const FString Inner = DescribeProperty(ArrayProperty->Inner);
+		return Inner.IsEmpty() ? FString() : TEXT("array<") + Inner + TEXT(">");
+	}
+	if (FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		const FString Element = DescribeProperty(SetProperty->ElementProp);
+		return Element.IsEmpty() ? FString() : TEXT("set<") + Element + TEXT(">");
+	}
+	if (FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		const FString Key = DescribeProperty(MapProperty->KeyProp);
+		const FString Value = DescribeProperty(MapProperty->ValueProp);
+		return (Key.IsEmpty() || Value.IsEmpty()) ? FString() : TEXT("map<") + Key + TEXT(",") + Value + TEXT(">");
+	}
+	return FString();
+}
+
+FProperty* FGESPayloadCodec::PropertyForDescriptor(const FString& Descriptor)
+{
+	if (FProperty** Found = DescribedProperties.Find(Descriptor))
+	{
+		return *Found;
+	}
+	if (DescribedProperties.Num() >= MaxDescribedProperties)
+	{
+		return nullptr;
+	}
+
+	FDescriptorNode Root;
+	int32 Index = 0;
+	if (!ParseDescriptor(Descriptor, Index, Root, 0) || Index != Descriptor.Len())
+	{
+		return nullptr;
+	}
+
+	//owned by a class that lives as long as the module like pooled properties, construction links it in, undo that
+	UClass* Owner = UGlobalEventSystemBPLibrary::StaticClass();
+	FField* OldProperty = Owner->ChildProperties;
+	FProperty* Property = NewDescribedProperty(Root, FFieldVariant(Owner), TEXT("DescribedValue"));
+	Owner->ChildProperties = OldProperty;
+	if (!Property)
+	{
+		return nullptr;
+	}
+
+	//sizes and container layouts
+	FArchive LinkAr;
+	Property->Link(LinkAr);
+
+	DescribedProperties.Add(Descriptor, Property);
+	return Property;
+}
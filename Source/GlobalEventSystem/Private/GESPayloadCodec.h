@@ -0,0 +1,76 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+#include "GESHandlerDataTypes.h"
+#include "GESWireFormat.h"
+
+class FGESHandler;
+
+/** A payload read back from the wire format. Values are copies, safe to hold onto. */
+struct FGESDecodedPayload
+{
+	GESWire::EPayloadType Type;
+	bool BoolValue;
+	int64 IntValue;
+	double FloatValue;
+
+	//String/Name value, object or struct path, or cpp type for Property payloads
+	FString StringValue;
+
+	//Serialized struct or property value
+	TArray<uint8> Blob;
+
+	//Exact type of Typed payloads (see GESWireFormat.h), the fields above hold the inner payload
+	FString TypeDescriptor;
+
+	FGESDecodedPayload()
+	{
+		Type = GESWire::EPayloadType::None;
+		BoolValue = false;
+		IntValue = 0;
+		FloatValue = 0.0;
+	}
+};
+
+/**
+* Encodes FProperty payloads into the GES wire format (see GESWireFormat.h) and re-emits
+* decoded payloads. Objects and names are stored as strings so data survives across processes.
+*/
+class FGESPayloadCodec
+{
+public:
+	template<typename T>
+	static void AppendValue(TArray<uint8>& OutBytes, T Value)
+	{
+		OutBytes.Append((const uint8*)&Value, sizeof(T));
+	}
+
+	static void EncodeString(const FString& String, TArray<uint8>& OutBytes);
+	static bool DecodeString(GESWire::FReader& Reader, FString& OutString);
+
+	/**
+	* Appends type tag + value for the property at PropertyPtr. Null property encodes as None. Types the tag
+	* alone doesn't name (integer widths, enums, object classes, containers) are wrapped in a Typed payload.
+	*/
+	static void EncodePayload(FProperty* Property, const void* PropertyPtr, TArray<uint8>& OutBytes);
+	static bool DecodePayload(GESWire::FReader& Reader, FGESDecodedPayload& OutPayload);
+
+	/** Message = domain, event, pinned flag and payload */
+	static void EncodeMessage(const FGESPropertyEmitContext& EmitData, TArray<uint8>& OutBytes);
+	static bool DecodeMessage(GESWire::FReader& Reader, FGESEmitContext& OutContext, FGESDecodedPayload& OutPayload);
+
+	/**
+	* Emits a decoded payload on Handler with the type it was encoded with. Typed payloads are emitted through a
+	* property rebuilt from their descriptor, property payloads without one (version 1 recordings) are skipped.
+	*/
+	static bool EmitDecodedPayload(FGESHandler& Handler, const FGESEmitContext& EmitData, const FGESDecodedPayload& Payload);
+
+	/** Type descriptor of Property, empty if it can't be described (see GESWireFormat.h) */
+	static FString DescribeProperty(FProperty* Property);
+
+	/** Long lived property for Descriptor, built once per descriptor. nullptr if a type isn't found or invalid. */
+	static FProperty* PropertyForDescriptor(const FString& Descriptor);
+};
@@ -0,0 +1,74 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESPropertyPool.h"
+#include "GlobalEventSystemBPLibrary.h"
+
+namespace
+{
+	template<typename TPropertyType>
+	TPropertyType* MakePooledProperty(const TCHAR* Name)
+	{
+		//owned by a class that lives as long as the module, so field paths to it stay resolvable
+		UClass* Owner = UGlobalEventSystemBPLibrary::StaticClass();
+
+		//construction links the property into the owner, undo that so it won't be traversed
+		FField* OldProperty = Owner->ChildProperties;
+		TPropertyType* Property = new TPropertyType(FFieldVariant(Owner), Name, EObjectFlags::RF_Public | EObjectFlags::RF_LoadCompleted);
+		Owner->ChildProperties = OldProperty;
+		return Property;
+	}
+}
+
+FBoolProperty* FGESPropertyPool::Bool()
+{
+	static FBoolProperty* Property = nullptr;
+	if (!Property)
+	{
+		Property = MakePooledProperty<FBoolProperty>(TEXT("BoolValue"));
+
+		//plain native bool, not a bitfield
+		Property->SetBoolSize(sizeof(bool), true);
+	}
+	return Property;
+}
+
+FIntProperty* FGESPropertyPool::Int()
+{
+	static FIntProperty* Property = MakePooledProperty<FIntProperty>(TEXT("IntValue"));
+	return Property;
+}
+
+FFloatProperty* FGESPropertyPool::Float()
+{
+	static FFloatProperty* Property = MakePooledProperty<FFloatProperty>(TEXT("FloatValue"));
+	return Property;
+}
+
+FDoubleProperty* FGESPropertyPool::Double()
+{
+	static FDoubleProperty* Property = MakePooledProperty<FDoubleProperty>(TEXT("DoubleValue"));
+	return Property;
+}
+
+FStrProperty* FGESPropertyPool::Str()
+{
+	static FStrProperty* Property = MakePooledProperty<FStrProperty>(TEXT("StringValue"));
+	return Property;
+}
+
+FNameProperty* FGESPropertyPool::Name()
+{
+	static FNameProperty* Property = MakePooledProperty<FNameProperty>(TEXT("NameValue"));
+	return Property;
+}
+
+FObjectProperty* FGESPropertyPool::Object()
+{
+	static FObjectProperty* Property = nullptr;
+	if (!Property)
+	{
+		Property = MakePooledProperty<FObjectProperty>(TEXT("ObjectValue"));
+		Property->PropertyClass = UObject::StaticClass();
+	}
+	return Property;
+}
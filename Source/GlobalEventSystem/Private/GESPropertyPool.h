@@ -0,0 +1,23 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+
+/**
+* Long lived properties describing plain values for typed emits (C++ overloads and typed blueprint
+* emit nodes). Created once per type instead of allocating and deleting a property on every emit.
+* Game thread only.
+*/
+class FGESPropertyPool
+{
+public:
+	static FBoolProperty* Bool();
+	static FIntProperty* Int();
+	static FFloatProperty* Float();
+	static FDoubleProperty* Double();
+	static FStrProperty* Str();
+	static FNameProperty* Name();
+	static FObjectProperty* Object();
+};
@@ -0,0 +1,34 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESScopeComponent.h"
+#include "GameFramework/Actor.h"
+
+UGESScopeComponent::UGESScopeComponent(const FObjectInitializer& init) : UActorComponent(init)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+TSharedPtr<FGESHandler> UGESScopeComponent::GetBus()
+{
+	if (!Bus.IsValid())
+	{
+		Bus = FGESHandler::MakeScoped(GetOwner() ? GetOwner()->GetFName() : GetFName());
+	}
+	return Bus;
+}
+
+TSharedPtr<FGESHandler> UGESScopeComponent::FindBus() const
+{
+	return Bus;
+}
+
+void UGESScopeComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	if (Bus.IsValid())
+	{
+		//world listeners only exist for scheduled emits on this bus
+		Bus->ReleaseWorldListeners();
+		Bus.Reset();
+	}
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
@@ -0,0 +1,162 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESSpatialIndex.h"
+
+FGESSpatialIndex::FGESSpatialIndex(float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.f);
+}
+
+FGESSpatialIndex::~FGESSpatialIndex()
+{
+	//sources outlive the index, their move events must not call into it anymore
+	for (FEntry& Entry : Entries)
+	{
+		USceneComponent* Source = Entry.Listener.GetPositionSource();
+		if (Source)
+		{
+			Source->TransformUpdated.Remove(Entry.MovedHandle);
+		}
+	}
+}
+
+void FGESSpatialIndex::Add(const FGESEventListener& Listener)
+{
+	USceneComponent* Source = Listener.GetPositionSource();
+	if (!Source)
+	{
+		return;
+	}
+
+	const FEntryKey Key(Listener.ReceiverWCO, Listener.FunctionName);
+	if (const int32* Existing = EntryIndices.Find(Key))
+	{
+		RemoveAt(*Existing);
+	}
+
+	FEntry Entry;
+	Entry.Listener = Listener;
+	Entry.Location = Source->GetComponentLocation();
+	Entry.Cell = CellOf(Entry.Location);
+
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	Entries[Index].MovedHandle = Source->TransformUpdated.AddRaw(this, &FGESSpatialIndex::OnSourceMoved, Index);
+	Cells.FindOrAdd(Entries[Index].Cell).Add(Index);
+	EntryIndices.Add(Key, Index);
+}
+
+void FGESSpatialIndex::Remove(const FGESMinimalEventListener& Listener)
+{
+	int32 Index;
+	if (EntryIndices.RemoveAndCopyValue(FEntryKey(Listener.ReceiverWCO, Listener.FunctionName), Index))
+	{
+		RemoveAt(Index);
+	}
+}
+
+void FGESSpatialIndex::Query(const FVector& Location, float Radius, TArray<FGESEventListener, TInlineAllocator<16>>& OutListeners) const
+{
+	const float RadiusSquared = Radius * Radius;
+	const FIntPoint Min = CellOf(Location - FVector(Radius));
+	const FIntPoint Max = CellOf(Location + FVector(Radius));
+
+	auto GatherCell = [this, &Location, RadiusSquared, &OutListeners](const TArray<int32>& Cell)
+	{
+		for (int32 Index : Cell)
+		{
+			const FEntry& Entry = Entries[Index];
+			if (FVector::DistSquared(Entry.Location, Location) <= RadiusSquared && Entry.Listener.GetPositionSource() != nullptr)
+			{
+				OutListeners.Add(Entry.Listener);
+			}
+		}
+	};
+
+	//large radii cover more cells than are occupied, walk the occupied ones instead
+	const int64 RangeCells = (int64)(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1);
+	if (RangeCells > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+		{
+			if (Pair.Key.X >= Min.X && Pair.Key.X <= Max.X && Pair.Key.Y >= Min.Y && Pair.Key.Y <= Max.Y)
+			{
+				GatherCell(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; X++)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			if (const TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y)))
+			{
+				GatherCell(*Cell);
+			}
+		}
+	}
+}
+
+int32 FGESSpatialIndex::Num() const
+{
+	return Entries.Num();
+}
+
+SIZE_T FGESSpatialIndex::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Entries.GetAllocatedSize() + Cells.GetAllocatedSize() + EntryIndices.GetAllocatedSize();
+	for (const TPair<FIntPoint, TArray<int32>>& Pair : Cells)
+	{
+		Bytes += Pair.Value.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+FIntPoint FGESSpatialIndex::CellOf(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void FGESSpatialIndex::OnSourceMoved(USceneComponent* Source, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+	Entry.Location = Source->GetComponentLocation();
+
+	//most moves stay within the cell
+	const FIntPoint NewCell = CellOf(Entry.Location);
+	if (NewCell == Entry.Cell)
+	{
+		return;
+	}
+
+	TArray<int32>& OldCell = Cells.FindChecked(Entry.Cell);
+	OldCell.RemoveSingleSwap(Index, false);
+	if (OldCell.Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+
+	Entry.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Index);
+}
+
+void FGESSpatialIndex::RemoveAt(int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+
+	USceneComponent* Source = Entry.Listener.GetPositionSource();
+	if (Source)
+	{
+		Source->TransformUpdated.Remove(Entry.MovedHandle);
+	}
+
+	TArray<int32>& Cell = Cells.FindChecked(Entry.Cell);
+	Cell.RemoveSingleSwap(Index, false);
+	if (Cell.Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+
+	Entries.RemoveAt(Index);
+}
@@ -0,0 +1,59 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "GESHandlerDataTypes.h"
+
+/**
+* Uniform grid over the positioned listeners of one event (FGESEventListener::PositionSource), bucketed by XY cell.
+* Entries follow their source through its TransformUpdated event and only change buckets when they cross a cell
+* border, so located emits (FGESHandler::EmitAtLocation) visit the cells around them instead of every listener.
+* Game thread only.
+*/
+class FGESSpatialIndex
+{
+public:
+	FGESSpatialIndex(float InCellSize);
+	~FGESSpatialIndex();
+
+	/** Index Listener at its position source, replaces an entry of the same receiver and function name */
+	void Add(const FGESEventListener& Listener);
+
+	/** Drop the entry of Listener, matched by receiver and function name like FGESListenerArray::Remove */
+	void Remove(const FGESMinimalEventListener& Listener);
+
+	/** Copy the listeners within Radius of Location. Listeners whose source is gone are skipped. */
+	void Query(const FVector& Location, float Radius, TArray<FGESEventListener, TInlineAllocator<16>>& OutListeners) const;
+
+	/** Indexed listeners */
+	int32 Num() const;
+
+	/** Bytes allocated by entries and cells, for memory reports */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FEntry
+	{
+		//copy of the listener in the event's listener array, delivered directly by located emits
+		FGESEventListener Listener;
+
+		//last known location of the source and the cell it is bucketed in
+		FVector Location;
+		FIntPoint Cell;
+
+		FDelegateHandle MovedHandle;
+	};
+
+	typedef TPair<TWeakObjectPtr<UObject>, FName> FEntryKey;
+
+	FIntPoint CellOf(const FVector& Location) const;
+	void OnSourceMoved(USceneComponent* Source, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 Index);
+	void RemoveAt(int32 Index);
+
+	float CellSize;
+	TSparseArray<FEntry> Entries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TMap<FEntryKey, int32> EntryIndices;
+};
@@ -0,0 +1,195 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESTimerWheel.h"
+
+FGESTimerWheel::FGESTimerWheel(double InResolution)
+{
+	Resolution = InResolution;
+	CurrentTick = 0;
+	NextSerial = 1;
+	NextTickTime = 0.0;
+}
+
+FGESTimerWheel::FHandle FGESTimerWheel::Add(double Delay, double Now, TFunction<void()> Callback)
+{
+	if (Entries.Num() == 0)
+	{
+		//idle wheel, restart from now instead of catching up on skipped ticks
+		NextTickTime = Now + Resolution;
+	}
+
+	const int64 Ticks = FMath::Max<int64>(1, (int64)FMath::CeilToDouble(Delay / Resolution));
+	return AddTicks((uint64)Ticks, MoveTemp(Callback));
+}
+
+void FGESTimerWheel::Advance(double Now)
+{
+	if (Entries.Num() == 0 || Now < NextTickTime)
+	{
+		return;
+	}
+
+	//every tick due by Now, after a hitch that can be a lot of them
+	const uint64 Elapsed = (uint64)((Now - NextTickTime) / Resolution) + 1;
+	const uint64 TargetTick = CurrentTick + Elapsed;
+	NextTickTime += Elapsed * Resolution;
+
+	//ticks without an occupied slot do nothing, go straight to the next one that has work
+	while (Entries.Num() > 0 && CurrentTick < TargetTick)
+	{
+		CurrentTick = FMath::Min(NextOccupiedTick(), TargetTick) - 1;
+		Tick();
+	}
+}
+
+FGESTimerWheel::FHandle FGESTimerWheel::AddTicks(uint64 Ticks, TFunction<void()> Callback)
+{
+	//slots are allocated with the first timer
+	if (Slots.Num() == 0)
+	{
+		Slots.SetNum(NumLevels * SlotsPerLevel);
+	}
+
+	FEntry Entry;
+	Entry.ExpireTick = CurrentTick + FMath::Max<uint64>(Ticks, 1);
+	Entry.Serial = NextSerial++;
+	Entry.Callback = MoveTemp(Callback);
+
+	const uint32 Serial = Entry.Serial;
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	Insert(Index);
+
+	return ((FHandle)Serial << 32) | (uint32)Index;
+}
+
+void FGESTimerWheel::Tick()
+{
+	CurrentTick++;
+	if (Slots.Num() == 0)
+	{
+		return;
+	}
+
+	//levels above a wrapped level hand their current slot down, top first so timers can fall through several levels
+	int32 CascadeLevel = 0;
+	while (CascadeLevel + 1 < NumLevels && (CurrentTick & ((1ull << (LevelBits * (CascadeLevel + 1))) - 1)) == 0)
+	{
+		CascadeLevel++;
+	}
+	for (int32 Level = CascadeLevel; Level >= 1; Level--)
+	{
+		TArray<FHandle> Cascaded = MoveTemp(Slot(Level, CurrentTick));
+		for (FHandle Handle : Cascaded)
+		{
+			if (IsValidHandle(Handle))
+			{
+				Insert((int32)(uint32)Handle);
+			}
+		}
+	}
+
+	TArray<FHandle> Due = MoveTemp(Slot(0, CurrentTick));
+	if (Due.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TFunction<void()>, TInlineAllocator<8>> Expired;
+	for (FHandle Handle : Due)
+	{
+		if (IsValidHandle(Handle))
+		{
+			const int32 Index = (int32)(uint32)Handle;
+			Expired.Add(MoveTemp(Entries[Index].Callback));
+			Entries.RemoveAt(Index);
+		}
+	}
+
+	//run outside the slot loop, callbacks may add or cancel timers
+	for (TFunction<void()>& Callback : Expired)
+	{
+		Callback();
+	}
+}
+
+bool FGESTimerWheel::Cancel(FHandle Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return false;
+	}
+
+	//the slot keeps the handle until it is reached, stale handles are skipped there
+	Entries.RemoveAt((int32)(uint32)Handle);
+	return true;
+}
+
+int32 FGESTimerWheel::Num() const
+{
+	return Entries.Num();
+}
+
+SIZE_T FGESTimerWheel::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Slots.GetAllocatedSize() + Entries.GetAllocatedSize();
+	for (const TArray<FHandle>& Handles : Slots)
+	{
+		Bytes += Handles.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+void FGESTimerWheel::Insert(int32 Index)
+{
+	FEntry& Entry = Entries[Index];
+	const FHandle Handle = ((FHandle)Entry.Serial << 32) | (uint32)Index;
+
+	//cascaded entries due this tick land in the level 0 slot processed right after the cascade
+	const uint64 Delta = Entry.ExpireTick > CurrentTick ? Entry.ExpireTick - CurrentTick : 0;
+
+	const uint64 MaxDelta = (1ull << (LevelBits * NumLevels)) - 1;
+	if (Delta > MaxDelta)
+	{
+		//beyond the wheel range (years at timeout resolution), fire at the end of the range
+		Entry.ExpireTick = CurrentTick + MaxDelta;
+	}
+
+	int32 Level = 0;
+	while (Level + 1 < NumLevels && Delta >= (1ull << (LevelBits * (Level + 1))))
+	{
+		Level++;
+	}
+
+	Slot(Level, Entry.ExpireTick).Add(Handle);
+}
+
+uint64 FGESTimerWheel::NextOccupiedTick() const
+{
+	uint64 Next = MAX_uint64;
+	for (int32 Level = 0; Level < Slots.Num() / SlotsPerLevel; Level++)
+	{
+		//a level's slot is processed on ticks that are a multiple of its span, in slot order
+		const int32 Shift = LevelBits * Level;
+		const uint64 FirstIndex = (CurrentTick >> Shift) + 1;
+		for (int32 SlotIndex = 0; SlotIndex < SlotsPerLevel; SlotIndex++)
+		{
+			if (Slots[Level * SlotsPerLevel + SlotIndex].Num() > 0)
+			{
+				const uint64 Index = FirstIndex + (((uint64)SlotIndex - FirstIndex) & (SlotsPerLevel - 1));
+				Next = FMath::Min(Next, Index << Shift);
+			}
+		}
+	}
+	return Next;
+}
+
+bool FGESTimerWheel::IsValidHandle(FHandle Handle) const
+{
+	const int32 Index = (int32)(uint32)Handle;
+	return Entries.IsValidIndex(Index) && Entries[Index].Serial == (uint32)(Handle >> 32);
+}
+
+TArray<FGESTimerWheel::FHandle>& FGESTimerWheel::Slot(int32 Level, uint64 AtTick)
+{
+	return Slots[Level * SlotsPerLevel + (int32)((AtTick >> (LevelBits * Level)) & (SlotsPerLevel - 1))];
+}
@@ -0,0 +1,67 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Hierarchical timer wheel for handler timeouts (request expiry, WaitForEvent) and scheduled emits. Five levels
+* of 64 slots, a timer sits in the coarsest level that still resolves it and cascades down as it gets closer.
+* Adding, cancelling and expiring are O(1) amortized. Drive a wheel either by seconds (Add/Advance) or by
+* ticks (AddTicks/Tick, e.g. frames), not both. Game thread only.
+*/
+class FGESTimerWheel
+{
+public:
+	typedef uint64 FHandle;
+
+	FGESTimerWheel(double InResolution = 0.05);
+
+	/** Run Callback once Delay seconds past Now have passed, rounded up to the wheel resolution */
+	FHandle Add(double Delay, double Now, TFunction<void()> Callback);
+
+	/** Advance the wheel to Now (same clock as Add), runs every expired callback. Skips ticks without timers. */
+	void Advance(double Now);
+
+	/** Run Callback on the Ticks-th call to Tick from now, at least the next one */
+	FHandle AddTicks(uint64 Ticks, TFunction<void()> Callback);
+
+	/** Advance by a single tick, runs every expired callback */
+	void Tick();
+
+	/** Drop a pending timer. Returns false if it already ran or was cancelled. */
+	bool Cancel(FHandle Handle);
+
+	/** Pending timers */
+	int32 Num() const;
+
+	/** Bytes allocated by the slots and pending timers, for memory reports */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static constexpr int32 LevelBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << LevelBits;
+	static constexpr int32 NumLevels = 5;
+
+	struct FEntry
+	{
+		uint64 ExpireTick;
+		uint32 Serial;
+		TFunction<void()> Callback;
+	};
+
+	//file the entry in the slot matching its distance to CurrentTick
+	void Insert(int32 Index);
+	bool IsValidHandle(FHandle Handle) const;
+
+	//first tick after CurrentTick that expires or cascades a non-empty slot
+	uint64 NextOccupiedTick() const;
+	TArray<FHandle>& Slot(int32 Level, uint64 AtTick);
+
+	TSparseArray<FEntry> Entries;
+	TArray<TArray<FHandle>> Slots;
+	uint64 CurrentTick;
+	uint32 NextSerial;
+	double Resolution;
+	double NextTickTime;
+};
@@ -0,0 +1,229 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESTypedReceiverComponents.h"
+#include "GESHandler.h"
+#include "GlobalEventSystem.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	//Struct receivers only accept the exact engine struct
+	template<typename T>
+	bool CopyBaseStruct(const FGESEventContext& Context, UStruct* Struct, void* StructPtr, T& OutValue)
+	{
+		if (Struct != TBaseStructure<T>::Get())
+		{
+			GES_EMIT_LOG(Warning, TEXT("GESTypedReceiverComponent %s.%s expected %s, received %s; Receive skipped."),
+				*Context.Domain, *Context.Event, *TBaseStructure<T>::Get()->GetName(), Struct ? *Struct->GetName() : TEXT("nullptr"));
+			return false;
+		}
+		OutValue = *(T*)StructPtr;
+		return true;
+	}
+}
+
+UGESTypedReceiverComponent::UGESTypedReceiverComponent()
+{
+	Domain = TEXT("global.default");
+	Event = TEXT("");
+	DeliveryPhase = EGESDeliveryPhase::Immediate;
+	bListenAtOwnerLocation = false;
+	bBindOnBeginPlay = true;
+	bUnbindOnEndPlay = true;
+	bDidReceiveEventAtLeastOnce = false;
+	bIsBound = false;
+}
+
+void UGESTypedReceiverComponent::Bind()
+{
+	Unbind();
+
+	BoundContext.Domain = Domain;
+	BoundContext.Event = Event;
+	BoundContext.WorldContext = this;
+	BoundContext.DeliveryPhase = DeliveryPhase;
+	BoundContext.PositionSource = (bListenAtOwnerLocation && GetOwner()) ? GetOwner()->GetRootComponent() : nullptr;
+	BoundLambdaName = AddTypedListener(BoundContext);
+	bIsBound = true;
+}
+
+void UGESTypedReceiverComponent::Unbind()
+{
+	if (!bIsBound)
+	{
+		return;
+	}
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(BoundContext.Domain, this);
+	if (Handler.IsValid())
+	{
+		Handler->RemoveLambdaListener(BoundContext, BoundLambdaName);
+	}
+	bIsBound = false;
+}
+
+void UGESTypedReceiverComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	if (bBindOnBeginPlay)
+	{
+		Bind();
+	}
+}
+
+void UGESTypedReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bUnbindOnEndPlay)
+	{
+		Unbind();
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+UGESBoolReceiverComponent::UGESBoolReceiverComponent()
+{
+	LastValue = false;
+}
+
+FString UGESBoolReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESBoolReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListenerBool(Context, [WeakThis](bool Value)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->LastValue = Value;
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnBoolReceived.Broadcast(Value);
+		}
+	});
+}
+
+UGESFloatReceiverComponent::UGESFloatReceiverComponent()
+{
+	LastValue = 0.f;
+}
+
+FString UGESFloatReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESFloatReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis](float Value)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->LastValue = Value;
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnFloatReceived.Broadcast(Value);
+		}
+	});
+}
+
+UGESIntReceiverComponent::UGESIntReceiverComponent()
+{
+	LastValue = 0;
+}
+
+FString UGESIntReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESIntReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListenerInt(Context, [WeakThis](int32 Value)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->LastValue = Value;
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnIntReceived.Broadcast(Value);
+		}
+	});
+}
+
+UGESObjectReceiverComponent::UGESObjectReceiverComponent()
+{
+	LastValue = nullptr;
+}
+
+FString UGESObjectReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESObjectReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis](UObject* Value)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->LastValue = Value;
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnObjectReceived.Broadcast(Value);
+		}
+	});
+}
+
+UGESRotatorReceiverComponent::UGESRotatorReceiverComponent()
+{
+	LastValue = FRotator::ZeroRotator;
+}
+
+FString UGESRotatorReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESRotatorReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis, Context](UStruct* Struct, void* StructPtr)
+	{
+		if (WeakThis.IsValid() && CopyBaseStruct(Context, Struct, StructPtr, WeakThis->LastValue))
+		{
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnRotatorReceived.Broadcast(WeakThis->LastValue);
+		}
+	});
+}
+
+UGESStringReceiverComponent::UGESStringReceiverComponent()
+{
+	LastValue = TEXT("");
+}
+
+FString UGESStringReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESStringReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis](const FString& Value)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->LastValue = Value;
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnStringReceived.Broadcast(Value);
+		}
+	});
+}
+
+UGESTransformReceiverComponent::UGESTransformReceiverComponent()
+{
+	LastValue = FTransform::Identity;
+}
+
+FString UGESTransformReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESTransformReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis, Context](UStruct* Struct, void* StructPtr)
+	{
+		if (WeakThis.IsValid() && CopyBaseStruct(Context, Struct, StructPtr, WeakThis->LastValue))
+		{
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnTransformReceived.Broadcast(WeakThis->LastValue);
+		}
+	});
+}
+
+UGESVectorReceiverComponent::UGESVectorReceiverComponent()
+{
+	LastValue = FVector::ZeroVector;
+}
+
+FString UGESVectorReceiverComponent::AddTypedListener(const FGESEventContext& Context)
+{
+	TWeakObjectPtr<UGESVectorReceiverComponent> WeakThis = this;
+	return FGESHandler::ForDomain(Context.Domain, this)->AddLambdaListener(Context, [WeakThis, Context](UStruct* Struct, void* StructPtr)
+	{
+		if (WeakThis.IsValid() && CopyBaseStruct(Context, Struct, StructPtr, WeakThis->LastValue))
+		{
+			WeakThis->bDidReceiveEventAtLeastOnce = true;
+			WeakThis->OnVectorReceived.Broadcast(WeakThis->LastValue);
+		}
+	});
+}
@@ -0,0 +1,102 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "LatentActions.h"
+#include "Engine/LatentActionManager.h"
+#include "GESHandler.h"
+
+/**
+* Latent action behind GESWaitForEvent. Waits on a one-shot listener, pinned events complete on the
+* first update without adding a listener.
+*/
+class FGESWaitForEventAction : public FPendingLatentAction
+{
+public:
+	FGESWaitForEventAction(UObject* WorldContextObject, const FLatentActionInfo& LatentInfo, EGESWaitResult& InResult, const FString& Domain, const FString& Event, float Timeout)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, Result(InResult)
+		, TimeRemaining(Timeout)
+		, bReceivedPinned(false)
+	{
+		Listener.Domain = Domain;
+		Listener.Event = Event;
+
+		TSharedPtr<FGESHandler> Handler = FGESHandler::ForDomain(Domain, WorldContextObject);
+		if (Handler->IsEventPinned(Domain, Event))
+		{
+			bReceivedPinned = true;
+			return;
+		}
+
+		FGESEventContext Context;
+		Context.Domain = Domain;
+		Context.Event = Event;
+		Context.WorldContext = WorldContextObject;
+
+		TSharedPtr<bool> Received = MakeShared<bool>(false);
+		ReceivedFlag = Received;
+		Listener.Listener.ReceiverWCO = WorldContextObject;
+		Listener.Listener.FunctionName = FName(*Handler->AddOneShotLambdaListener(Context, [Received](const FGESWildcardProperty& Data)
+		{
+			*Received = true;
+		}));
+	}
+
+	virtual ~FGESWaitForEventAction()
+	{
+		//timed out or aborted, drop the listener that never fired
+		if (!HasReceived() && !Listener.Listener.FunctionName.IsNone())
+		{
+			TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Listener.Domain, Listener.Listener.ReceiverWCO.Get());
+			if (Handler.IsValid())
+			{
+				Handler->RemoveListener(Listener.Domain, Listener.Event, FGESEventListener(Listener.Listener));
+			}
+		}
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		const bool bReceived = HasReceived();
+		bool bTimedOut = false;
+		if (!bReceived && TimeRemaining > 0.f)
+		{
+			TimeRemaining -= Response.ElapsedTime();
+			bTimedOut = TimeRemaining <= 0.f;
+		}
+
+		if (bReceived || bTimedOut)
+		{
+			Result = bReceived ? EGESWaitResult::Received : EGESWaitResult::TimedOut;
+		}
+		Response.FinishAndTriggerIf(bReceived || bTimedOut, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return FString::Printf(TEXT("Waiting for %s.%s"), *Listener.Domain, *Listener.Event);
+	}
+#endif
+
+private:
+	bool HasReceived() const
+	{
+		return bReceivedPinned || (ReceivedFlag.IsValid() && *ReceivedFlag);
+	}
+
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+	EGESWaitResult& Result;
+
+	//Timeout <= 0 waits until the event fires
+	float TimeRemaining;
+
+	bool bReceivedPinned;
+	TSharedPtr<bool> ReceivedFlag;
+	FGESEventListenerWithContext Listener;
+};
@@ -0,0 +1,113 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+/**
+* Binary wire format for GES payloads. Shared by the IPC bridge, the event recorder and
+* external tools so it is kept as plain C++ (no engine types) and can be compiled outside UE.
+*
+* All values are little endian. Strings and blobs are a u32 byte count followed by the bytes
+* (utf8 for strings, no terminator).
+*
+* Payload:	u8 EPayloadType, followed by the value for that type (see enum).
+*			Typed wraps a payload whose tag alone doesn't name the original type, e.g. an int16 sent as Int64:
+*			string type descriptor then the inner payload. Descriptors are a type name with optional
+*			<args>: bool, uint8, int8, int16, int32, int64, uint16, uint32, uint64, float, double, str, name,
+*			object<ClassPath>, struct<StructPath>, byte<EnumPath>, enum<EnumPath,Underlying>, array<T>,
+*			set<T>, map<K,V>. Readers that don't need the exact type can skip straight to the inner payload.
+* Message:	string Domain, string Event, u8 bPinned, Payload
+*
+* Recording file (FGESEventRecorder), append-only:
+*	u32 RecordingMagic, u32 RecordingVersion
+*	Chunks:	u32 ChunkBytes (excluding this header), u32 RecordCount, Records
+*	Records:	u8 ERecordType then
+*		KeyDefinition:	u32 KeyId, string Domain, string Event (always before first use of KeyId)
+*		Emit:			u32 KeyId, u64 Frame, f64 Seconds since start, u8 bPinned, Payload
+*/
+
+#include <cstdint>
+#include <cstring>
+
+namespace GESWire
+{
+	enum class EPayloadType : uint8_t
+	{
+		None = 0,		//no data
+		Bool = 1,		//u8
+		Byte = 2,		//u8
+		Int32 = 3,		//i32
+		Int64 = 4,		//i64, other integer widths and enums are widened to this
+		Float = 5,		//f32
+		Double = 6,		//f64
+		String = 7,		//string
+		Name = 8,		//string
+		Object = 9,		//string object path, empty for null
+		Struct = 10,	//string struct path, blob serialized struct
+		Property = 11,	//string cpp type, blob serialized value (containers and anything else)
+		Typed = 12,		//string type descriptor, inner payload (never Typed itself)
+	};
+
+	static constexpr uint32_t RecordingMagic = 0x52534547;	//'GESR'
+
+	//2 added Typed payloads, version 1 files are still read
+	static constexpr uint32_t RecordingVersion = 2;
+
+	enum class ERecordType : uint8_t
+	{
+		KeyDefinition = 1,
+		Emit = 2,
+	};
+
+	/** Bounds checked reader over a byte span, never reads past Num. */
+	struct FReader
+	{
+		const uint8_t* Data;
+		uint32_t Num;
+		uint32_t Offset;
+		bool bError;
+
+		FReader(const uint8_t* InData, uint32_t InNum)
+			: Data(InData)
+			, Num(InNum)
+			, Offset(0)
+			, bError(false)
+		{
+		}
+
+		bool ReadBytes(void* Out, uint32_t Count)
+		{
+			if (bError || Count > Num - Offset)
+			{
+				bError = true;
+				return false;
+			}
+			memcpy(Out, Data + Offset, Count);
+			Offset += Count;
+			return true;
+		}
+
+		template<typename T>
+		bool Read(T& Out)
+		{
+			return ReadBytes(&Out, sizeof(T));
+		}
+
+		//Points into Data, no copy
+		bool ReadSized(const uint8_t*& OutPtr, uint32_t& OutNum)
+		{
+			if (!Read(OutNum) || OutNum > Num - Offset)
+			{
+				bError = true;
+				return false;
+			}
+			OutPtr = Data + Offset;
+			Offset += OutNum;
+			return true;
+		}
+
+		bool IsAtEnd() const
+		{
+			return Offset >= Num;
+		}
+	};
+}
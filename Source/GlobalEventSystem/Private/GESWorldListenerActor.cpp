@@ -7,8 +7,10 @@
 AGESWorldListenerActor::AGESWorldListenerActor()
 {
  	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = false;
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	OnEndPlay = nullptr;
+	OnTick = nullptr;
 }
 
 // Called when the game starts or when spawned
@@ -18,9 +20,22 @@ void AGESWorldListenerActor::BeginPlay()
 	
 }
 
+void AGESWorldListenerActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+	if (OnTick)
+	{
+		OnTick(DeltaSeconds);
+	}
+}
+
 void AGESWorldListenerActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	OnEndPlay();
+	//unset when the owning handler went first (scoped buses)
+	if (OnEndPlay)
+	{
+		OnEndPlay();
+	}
 	Super::EndPlay(EndPlayReason);
 }
 
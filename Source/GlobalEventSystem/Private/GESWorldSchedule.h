@@ -0,0 +1,61 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GESDataTypes.h"
+#include "GESHandlerDataTypes.h"
+#include "GESTimerWheel.h"
+
+/** A pending EmitDelayed. The payload is copied when scheduling, repeats re-emit the same copy. */
+struct FGESScheduledEmit
+{
+	FGESEmitContext Context;
+
+	//the context's world context, the emit is dropped if it is gone when due
+	TWeakObjectPtr<UObject> WorldContext;
+
+	//same storage as event poll slots, Property must outlive the schedule (reflected or pooled properties)
+	FGESPollSlot Payload;
+
+	//object payloads are refreshed from this before each emit, scheduling doesn't keep them alive
+	bool bObjectPayload;
+	TWeakObjectPtr<UObject> ObjectPayload;
+
+	FGESEmitSchedule Schedule;
+
+	//emits left for repeating schedules with a Count, -1 repeats until cancelled
+	int32 RemainingEmits;
+
+	FGESTimerWheel::FHandle WheelHandle;
+
+	FGESScheduledEmit()
+	{
+		bObjectPayload = false;
+		RemainingEmits = 1;
+		WheelHandle = 0;
+	}
+};
+
+/**
+* Scheduled emits of one world. Time schedules run on world time and frame schedules on world ticks, both
+* advanced by the world listener actor while anything is pending. Dropped with everything in it when the world ends.
+*/
+struct FGESWorldSchedule
+{
+	FGESTimerWheel TimeWheel;
+	FGESTimerWheel FrameWheel;
+
+	//world seconds accumulated from ticks, the clock of TimeWheel
+	double WorldTime;
+
+	//by schedule handle, shared so an emit being delivered survives its own cancellation
+	TMap<int32, TSharedPtr<FGESScheduledEmit>> Emits;
+
+	FGESWorldSchedule()
+		: TimeWheel(0.01)
+		, FrameWheel(1.0)
+	{
+		WorldTime = 0.0;
+	}
+};
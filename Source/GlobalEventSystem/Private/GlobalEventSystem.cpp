@@ -9,12 +9,15 @@
 
 #define LOCTEXT_NAMESPACE "FGlobalEventSystemModule"
 
+DEFINE_LOG_CATEGORY(LogGES);
+LLM_DEFINE_TAG(GES);
+
 void FGlobalEventSystemModule::StartupModule()
 {
 #if WITH_EDITOR
 	EndPieDelegate = FEditorDelegates::BeginPIE.AddLambda([](bool boolSent)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Clearing FGESHandler"));
+		UE_LOG(LogGES, Log, TEXT("Clearing FGESHandler"));
 		FGESHandler::Clear();		
 	});
 #endif
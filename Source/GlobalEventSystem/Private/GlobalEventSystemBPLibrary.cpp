@@ -2,6 +2,10 @@
 
 #include "GlobalEventSystemBPLibrary.h"
 #include "GlobalEventSystem.h"
+#include "GESPropertyPool.h"
+#include "Components/SceneComponent.h"
+#include "GESWaitForEventAction.h"
+#include "Engine/Engine.h"
 
 UGlobalEventSystemBPLibrary::UGlobalEventSystemBPLibrary(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
@@ -12,9 +16,13 @@ void UGlobalEventSystemBPLibrary::GESUnbindEvent(UObject* WorldContextObject, co
 {
 	FGESEventListener Listener;
 	Listener.ReceiverWCO = WorldContextObject;
-	Listener.FunctionName = ReceivingFunction;
+	Listener.FunctionName = FName(*ReceivingFunction);
 
-	FGESHandler::DefaultHandler()->RemoveListener(Domain, Event, Listener);
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Domain, WorldContextObject);
+	if (Handler.IsValid())
+	{
+		Handler->RemoveListener(Domain, Event, Listener);
+	}
 }
 
 void UGlobalEventSystemBPLibrary::GESUnbindTagEvent(UObject* WorldContextObject, FGameplayTag Tag, const FString& ReceivingFunction /*= TEXT("")*/)
@@ -31,7 +39,24 @@ void UGlobalEventSystemBPLibrary::GESUnbindAllEventsForContext(UObject* WorldCon
 	{
 		Context = WorldContextObject;
 	}
-	FGESHandler::DefaultHandler()->RemoveAllListenersForReceiver(Context);
+	//most buses never saw this receiver, warn once if none of them did
+	bool bRemovedAny = false;
+	FGESHandler::ForEachHandler([Context, &bRemovedAny](FGESHandler& Handler)
+	{
+		bRemovedAny |= Handler.RemoveAllListenersForReceiver(Context, false);
+	});
+
+	//scoped buses aren't global, only the context's own actor scope can hold its listeners
+	TSharedPtr<FGESHandler> ScopedBus = FGESHandler::FindScope(Context);
+	if (ScopedBus.IsValid())
+	{
+		bRemovedAny |= ScopedBus->RemoveAllListenersForReceiver(Context, false);
+	}
+
+	if (!bRemovedAny)
+	{
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::GESUnbindAllEventsForContext %s has no bound events. Ignored."), *GetNameSafe(Context));
+	}
 }
 
 void UGlobalEventSystemBPLibrary::GESUnbindDelegate(UObject* WorldContextObject, const FGESOnePropertySignature& ReceivingFunction, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
@@ -41,16 +66,19 @@ void UGlobalEventSystemBPLibrary::GESUnbindDelegate(UObject* WorldContextObject,
 
 	if (ReceivingFunction.GetUObject()->IsValidLowLevelFast())
 	{
-		Listener.FunctionName = WorldContextObject->GetName() + ReceivingFunction.GetUObject()->GetName();
+		Listener.FunctionName = FName(*(WorldContextObject->GetName() + ReceivingFunction.GetUObject()->GetName()));
 	}
 	else
 	{
-		Listener.FunctionName = WorldContextObject->GetName() + TEXT(".UnboundDelegate");
+		Listener.FunctionName = FName(*(WorldContextObject->GetName() + TEXT(".UnboundDelegate")));
 	}
-	Listener.OnePropertyFunctionDelegate = ReceivingFunction;
-	Listener.bIsBoundToDelegate = true;
+	Listener.BindDelegate(ReceivingFunction);
 
-	FGESHandler::DefaultHandler()->RemoveListener(Domain, Event, Listener);
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Domain, WorldContextObject);
+	if (Handler.IsValid())
+	{
+		Handler->RemoveListener(Domain, Event, Listener);
+	}
 }
 
 void UGlobalEventSystemBPLibrary::GESUnbindTagDelegate(UObject* WorldContextObject, FGameplayTag Tag, const FGESOnePropertySignature& ReceivingFunction)
@@ -61,59 +89,69 @@ void UGlobalEventSystemBPLibrary::GESUnbindTagDelegate(UObject* WorldContextObje
 	GESUnbindDelegate(WorldContextObject, ReceivingFunction, Domain, Event);
 }
 
-void UGlobalEventSystemBPLibrary::GESBindEvent(UObject* WorldContextObject, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/, const FString& ReceivingFunction /*= TEXT("")*/)
+void UGlobalEventSystemBPLibrary::GESBindEvent(UObject* WorldContextObject, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/, const FString& ReceivingFunction /*= TEXT("")*/, EGESDeliveryPhase DeliveryPhase /*= EGESDeliveryPhase::Immediate*/, USceneComponent* PositionSource /*= nullptr*/)
 {
 	FGESEventListener Listener;
 	Listener.ReceiverWCO = WorldContextObject;
-	Listener.FunctionName = ReceivingFunction;
+	Listener.FunctionName = FName(*ReceivingFunction);
+	Listener.DeliveryPhase = DeliveryPhase;
+	Listener.SetPositionSource(PositionSource);
 	Listener.LinkFunction();	//this makes the function valid by finding a reference to it
 
-	FGESHandler::DefaultHandler()->AddListener(Domain, Event, Listener);
+	FGESHandler::ForDomain(Domain, WorldContextObject)->AddListener(Domain, Event, Listener);
 }
 
-void UGlobalEventSystemBPLibrary::GESBindTagEvent(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FString& ReceivingFunction /*= TEXT("")*/)
+void UGlobalEventSystemBPLibrary::GESBindTagEvent(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FString& ReceivingFunction /*= TEXT("")*/, EGESDeliveryPhase DeliveryPhase /*= EGESDeliveryPhase::Immediate*/, USceneComponent* PositionSource /*= nullptr*/)
 {
 	FGESEventListener Listener;
 	Listener.ReceiverWCO = WorldContextObject;
-	Listener.FunctionName = ReceivingFunction;
+	Listener.FunctionName = FName(*ReceivingFunction);
+	Listener.DeliveryPhase = DeliveryPhase;
+	Listener.SetPositionSource(PositionSource);
 	Listener.LinkFunction();	//this makes the function valid by finding a reference to it
 
 	FString Domain;
 	FString Event;
 	Conv_TagToDomainAndEvent(DomainedEventTag, Domain, Event);
 
-	FGESHandler::DefaultHandler()->AddListener(Domain, Event, Listener);
+	FGESHandler::ForDomain(Domain, WorldContextObject)->AddListener(Domain, Event, Listener);
 }
 
-void UGlobalEventSystemBPLibrary::GESBindTagEventToDelegate(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FGESOnePropertySignature& ReceivingFunction)
+void UGlobalEventSystemBPLibrary::GESBindTagEventToDelegate(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FGESOnePropertySignature& ReceivingFunction, EGESDeliveryPhase DeliveryPhase /*= EGESDeliveryPhase::Immediate*/, USceneComponent* PositionSource /*= nullptr*/)
 {
 	FString Domain;
 	FString Event;
 	Conv_TagToDomainAndEvent(DomainedEventTag, Domain, Event);
-	GESBindEventToDelegate(WorldContextObject, ReceivingFunction, Domain, Event);
+	GESBindEventToDelegate(WorldContextObject, ReceivingFunction, Domain, Event, DeliveryPhase, PositionSource);
 }
 
-void UGlobalEventSystemBPLibrary::GESBindEventToDelegate(UObject* WorldContextObject, const FGESOnePropertySignature& ReceivingFunction, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+void UGlobalEventSystemBPLibrary::GESBindEventToDelegate(UObject* WorldContextObject, const FGESOnePropertySignature& ReceivingFunction, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/, EGESDeliveryPhase DeliveryPhase /*= EGESDeliveryPhase::Immediate*/, USceneComponent* PositionSource /*= nullptr*/)
 {
 	FGESEventListener Listener;
 	Listener.ReceiverWCO = WorldContextObject;
+	Listener.DeliveryPhase = DeliveryPhase;
+	Listener.SetPositionSource(PositionSource);
 	if (ReceivingFunction.GetUObject()->IsValidLowLevelFast())
 	{
-		Listener.FunctionName = WorldContextObject->GetName() + ReceivingFunction.GetUObject()->GetName();
+		Listener.FunctionName = FName(*(WorldContextObject->GetName() + ReceivingFunction.GetUObject()->GetName()));
 	}
 	else
 	{
-		Listener.FunctionName = WorldContextObject->GetName() + TEXT(".UnboundDelegate");
+		Listener.FunctionName = FName(*(WorldContextObject->GetName() + TEXT(".UnboundDelegate")));
 	}
-	Listener.OnePropertyFunctionDelegate = ReceivingFunction;
-	Listener.bIsBoundToDelegate = true;
+	Listener.BindDelegate(ReceivingFunction);
 
-	FGESHandler::DefaultHandler()->AddListener(Domain, Event, Listener);
+	FGESHandler::ForDomain(Domain, WorldContextObject)->AddListener(Domain, Event, Listener);
 }
 
 void UGlobalEventSystemBPLibrary::HandleEmit(const FGESPropertyEmitContext& FullEmitData)
 {
-	FGESHandler::DefaultHandler()->EmitPropertyEvent(FullEmitData);
+	FGESHandler::ForDomain(FullEmitData.Domain, FullEmitData.WorldContext)->EmitPropertyEvent(FullEmitData);
+}
+
+void UGlobalEventSystemBPLibrary::HandleEmitBatch(const FGESEmitContext& EmitData, FArrayProperty* ArrayProperty, void* ArrayPtr)
+{
+	FGESHandler::ForDomain(EmitData.Domain, EmitData.WorldContext)->EmitBatch(EmitData, ArrayProperty, ArrayPtr);
 }
 
 void UGlobalEventSystemBPLibrary::GESEmitEventOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
@@ -121,6 +159,58 @@ void UGlobalEventSystemBPLibrary::GESEmitEventOneParam(UObject* WorldContextObje
 	//this never gets called due to custom thunk
 }
 
+void UGlobalEventSystemBPLibrary::GESEmitEventBatch(UObject* WorldContextObject, const TArray<int32>& Payloads, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+{
+	//this never gets called due to custom thunk
+}
+
+int32 UGlobalEventSystemBPLibrary::HandleEmitDelayed(const FGESPropertyEmitContext& EmitData, const FGESEmitSchedule& Schedule)
+{
+	return FGESHandler::ForDomain(EmitData.Domain, EmitData.WorldContext)->EmitDelayed(EmitData, Schedule, EmitData.Property, EmitData.PropertyPtr);
+}
+
+int32 UGlobalEventSystemBPLibrary::GESEmitEventDelayedOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, const FGESEmitSchedule& Schedule, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+{
+	//this never gets called due to custom thunk
+	return -1;
+}
+
+int32 UGlobalEventSystemBPLibrary::GESEmitEventDelayed(UObject* WorldContextObject, const FGESEmitSchedule& Schedule, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+{
+	FGESEmitContext EmitData;
+	EmitData.bPinned = bPinned;
+	EmitData.Domain = Domain;
+	EmitData.Event = Event;
+	EmitData.WorldContext = WorldContextObject;
+	return FGESHandler::ForDomain(Domain, WorldContextObject)->EmitDelayed(EmitData, Schedule);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventAtLocationOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, FVector Location, float Radius /*= 1000.f*/, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+{
+	//this never gets called due to custom thunk
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventAtLocation(UObject* WorldContextObject, FVector Location, float Radius /*= 1000.f*/, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
+{
+	FGESEmitContext EmitData;
+	EmitData.bPinned = bPinned;
+	EmitData.Domain = Domain;
+	EmitData.Event = Event;
+	EmitData.WorldContext = WorldContextObject;
+	FGESHandler::ForDomain(Domain, WorldContextObject)->EmitAtLocation(EmitData, Location, Radius);
+}
+
+bool UGlobalEventSystemBPLibrary::GESCancelScheduledEmit(int32 ScheduleHandle)
+{
+	//handles are unique across buses, only the owning bus finds it
+	bool bCancelled = false;
+	FGESHandler::ForEachHandler([ScheduleHandle, &bCancelled](FGESHandler& Handler)
+	{
+		bCancelled |= Handler.CancelScheduledEmit(ScheduleHandle);
+	}, true);
+	return bCancelled;
+}
+
 void UGlobalEventSystemBPLibrary::GESEmitEvent(UObject* WorldContextObject, bool bPinned /*= false*/, const FString& Domain /*= TEXT("global.default")*/, const FString& EventName /*= TEXT("")*/)
 {
 	if (!WorldContextObject)
@@ -145,7 +235,7 @@ void UGlobalEventSystemBPLibrary::GESEmitEvent(UObject* WorldContextObject, bool
 	EmitData.Domain = Domain;
 	EmitData.Event = EventName;
 	EmitData.WorldContext = WorldContextObject;
-	FGESHandler::DefaultHandler()->EmitEvent(EmitData);
+	FGESHandler::ForDomain(EmitData.Domain, EmitData.WorldContext)->EmitEvent(EmitData);
 }
 
 void UGlobalEventSystemBPLibrary::GESEmitTagEvent(UObject* WorldContextObject, FGameplayTag DomainedEventTag, bool bPinned /*= false*/)
@@ -154,7 +244,7 @@ void UGlobalEventSystemBPLibrary::GESEmitTagEvent(UObject* WorldContextObject, F
 	EmitData.bPinned = bPinned;
 	Conv_TagToDomainAndEvent(DomainedEventTag, EmitData.Domain, EmitData.Event);
 	EmitData.WorldContext = WorldContextObject;
-	FGESHandler::DefaultHandler()->EmitEvent(EmitData);
+	FGESHandler::ForDomain(EmitData.Domain, EmitData.WorldContext)->EmitEvent(EmitData);
 }
 
 void UGlobalEventSystemBPLibrary::GESEmitTagEventOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, FGameplayTag DomainedEventTag, bool bPinned /*= false*/)
@@ -162,9 +252,155 @@ void UGlobalEventSystemBPLibrary::GESEmitTagEventOneParam(UObject* WorldContextO
 	//this never gets called due to custom thunk
 }
 
+int32 UGlobalEventSystemBPLibrary::HandleEmitRequest(const FGESPropertyEmitContext& EmitData, const FGESOnePropertySignature& OnReply, float Timeout)
+{
+	return FGESHandler::ForDomain(EmitData.Domain, EmitData.WorldContext)->EmitRequest(EmitData, EmitData.Property, EmitData.PropertyPtr, [OnReply](bool bReplied, const FGESWildcardProperty& Reply)
+	{
+		//timeouts arrive as an empty wildcard property
+		OnReply.ExecuteIfBound(Reply);
+	}, Timeout);
+}
+
+int32 UGlobalEventSystemBPLibrary::GESEmitRequestOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, const FGESOnePropertySignature& OnReply, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/, float Timeout /*= 0.f*/)
+{
+	//this never gets called due to custom thunk
+	return -1;
+}
+
+bool UGlobalEventSystemBPLibrary::GESReplyOneParam(int32 RequestId, TFieldPath<FProperty> ParameterData)
+{
+	//this never gets called due to custom thunk
+	return false;
+}
+
+int32 UGlobalEventSystemBPLibrary::GESGetRequestId()
+{
+	return FGESHandler::DefaultHandler()->GetCurrentRequestId();
+}
+
+void UGlobalEventSystemBPLibrary::HandleTypedEmit(UObject* WorldContextObject, FProperty* Property, const void* ValuePtr, bool bPinned, const FGESEventHandle& Handle)
+{
+	FGESHandler::ForDomain(Handle.Domain, WorldContextObject)->EmitEvent(Handle, WorldContextObject, bPinned, Property, ValuePtr);
+}
+
+FGESEventHandle UGlobalEventSystemBPLibrary::GESMakeEventHandle(const FString& Domain, const FString& Event)
+{
+	return FGESEventHandle(Domain, Event);
+}
+
+void UGlobalEventSystemBPLibrary::GESBindEventHandle(UObject* WorldContextObject, const FGESEventHandle& Handle, const FString& ReceivingFunction, EGESDeliveryPhase DeliveryPhase, USceneComponent* PositionSource)
+{
+	FGESEventListener Listener;
+	Listener.ReceiverWCO = WorldContextObject;
+	Listener.FunctionName = FName(*ReceivingFunction);
+	Listener.DeliveryPhase = DeliveryPhase;
+	Listener.SetPositionSource(PositionSource);
+	Listener.LinkFunction();	//this makes the function valid by finding a reference to it
+
+	FGESHandler::ForDomain(Handle.Domain, WorldContextObject)->AddListener(Handle, Listener);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventNoData(UObject* WorldContextObject, bool bPinned, const FGESEventHandle& Handle)
+{
+	//same game world check as GESEmitEvent
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+	HandleTypedEmit(WorldContextObject, nullptr, nullptr, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventWildcard(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, bool bPinned, const FGESEventHandle& Handle)
+{
+	//this never gets called due to custom thunk
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventBool(UObject* WorldContextObject, bool Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Bool(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventInt(UObject* WorldContextObject, int32 Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Int(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventDouble(UObject* WorldContextObject, double Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	//blueprint floats are doubles, listeners see the same type as a wildcard emit of the same pin
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Double(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventString(UObject* WorldContextObject, const FString& Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Str(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventName(UObject* WorldContextObject, FName Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Name(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESEmitEventObject(UObject* WorldContextObject, UObject* Value, bool bPinned, const FGESEventHandle& Handle)
+{
+	HandleTypedEmit(WorldContextObject, FGESPropertyPool::Object(), &Value, bPinned, Handle);
+}
+
+void UGlobalEventSystemBPLibrary::GESWaitForEvent(UObject* WorldContextObject, FLatentActionInfo LatentInfo, EGESWaitResult& Result, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/, float Timeout /*= 0.f*/)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World)
+	{
+		return;
+	}
+
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FGESWaitForEventAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+	{
+		LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID,
+			new FGESWaitForEventAction(WorldContextObject, LatentInfo, Result, Domain, Event, Timeout));
+	}
+}
+
+int32 UGlobalEventSystemBPLibrary::GESAddJoin(UObject* WorldContextObject, const FGESJoinDefinition& Definition)
+{
+	//joins live on the bus of their output, inputs are bound on their own buses
+	return FGESHandler::ForDomain(Definition.Output.Domain, WorldContextObject)->AddJoin(WorldContextObject, Definition);
+}
+
+void UGlobalEventSystemBPLibrary::GESRemoveJoin(int32 JoinHandle)
+{
+	//handles are unique across buses, only the owning bus acts on it
+	FGESHandler::ForEachHandler([JoinHandle](FGESHandler& Handler)
+	{
+		Handler.RemoveJoin(JoinHandle);
+	}, true);
+}
+
+bool UGlobalEventSystemBPLibrary::GESGetPinnedValue(UObject* WorldContextObject, const FString& Domain, const FString& Event, TFieldPath<FProperty>& Value, int32& Version)
+{
+	//doesn't get called due to custom thunk
+	return false;
+}
+
+bool UGlobalEventSystemBPLibrary::HandleGetPinnedValue(UObject* WorldContextObject, const FString& Domain, const FString& Event, const FGESWildcardProperty& OutProp, int32& OutVersion)
+{
+	//reading never creates an actor scope, there is nothing pinned on one that doesn't exist
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Domain, WorldContextObject);
+	uint32 PinnedVersion = 0;
+	const bool bDidCopy = Handler.IsValid() && Handler->TryGetPinned(Domain, Event, OutProp.Property.Get(), OutProp.PropertyPtr, &PinnedVersion);
+	OutVersion = (int32)PinnedVersion;
+	return bDidCopy;
+}
+
 void UGlobalEventSystemBPLibrary::GESUnpinEvent(UObject* WorldContextObject, const FString& Domain /*= TEXT("global.default")*/, const FString& Event /*= TEXT("")*/)
 {
-	FGESHandler::DefaultHandler()->UnpinEvent(Domain, Event);
+	TSharedPtr<FGESHandler> Handler = FGESHandler::FindForDomain(Domain, WorldContextObject);
+	if (Handler.IsValid())
+	{
+		Handler->UnpinEvent(Domain, Event);
+	}
 }
 
 void UGlobalEventSystemBPLibrary::SetGESOptions(const FGESGlobalOptions& InOptions)
@@ -172,11 +408,26 @@ void UGlobalEventSystemBPLibrary::SetGESOptions(const FGESGlobalOptions& InOptio
 	FGESHandler::DefaultHandler()->SetOptions(InOptions);
 }
 
+void UGlobalEventSystemBPLibrary::GESRouteDomainToBus(const FString& DomainPrefix, FName BusName)
+{
+	FGESHandler::RouteDomain(DomainPrefix, BusName);
+}
+
+void UGlobalEventSystemBPLibrary::SetGESBusOptions(FName BusName, const FGESGlobalOptions& InOptions)
+{
+	FGESHandler::Bus(BusName)->SetOptions(InOptions);
+}
+
+FGESBusStats UGlobalEventSystemBPLibrary::GESGetBusStats(FName BusName)
+{
+	return FGESHandler::Bus(BusName)->GetStats();
+}
+
 bool UGlobalEventSystemBPLibrary::Conv_PropToInt(const FGESWildcardProperty& InProp, int32& OutInt)
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt InProp is a nullptr"));
 		return false;
 	}
 
@@ -190,14 +441,14 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToInt(const FGESWildcardProperty& InP
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt %s is not an integer number, float truncated to int."), *InProp.Property->GetName());
+			UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt %s is not an integer number, float truncated to int."), *InProp.Property->GetName());
 			OutInt = Property->GetFloatingPointPropertyValue(InProp.PropertyPtr);
 			return false;
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt %s is not an integer."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToInt %s is not an integer."), *InProp.Property->GetName());
 		return false;
 	}
 }
@@ -206,7 +457,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToFloat(const FGESWildcardProperty& I
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat InProp is a nullptr"));
 		return false;
 	}
 
@@ -220,14 +471,14 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToFloat(const FGESWildcardProperty& I
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat %s is not a floating number, converted int to float."), *InProp.Property->GetName());
+			UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat %s is not a floating number, converted int to float."), *InProp.Property->GetName());
 			OutFloat = Property->GetSignedIntPropertyValue(InProp.PropertyPtr);
 			return false;
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat %s is not a float."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToFloat %s is not a float."), *InProp.Property->GetName());
 		return false;
 	}
 }
@@ -236,7 +487,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToBool(const FGESWildcardProperty& In
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToBool InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToBool InProp is a nullptr"));
 		return false;
 	}
 
@@ -248,7 +499,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToBool(const FGESWildcardProperty& In
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToBool %s is not a bool."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToBool %s is not a bool."), *InProp.Property->GetName());
 		return false;
 	}
 }
@@ -257,7 +508,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToStringRef(const FGESWildcardPropert
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToStringRef InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToStringRef InProp is a nullptr"));
 		return false;
 	}
 
@@ -269,7 +520,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToStringRef(const FGESWildcardPropert
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToString %s is not an FString, attempted best conversion for display purposes."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToString %s is not an FString, attempted best conversion for display purposes."), *InProp.Property->GetName());
 
 		//Convert logic
 		if (InProp.Property->IsA<FNumericProperty>())
@@ -320,6 +571,21 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToStringRef(const FGESWildcardPropert
 			FStructProperty* Property = CastField<FStructProperty>(InProp.Property.Get());
 			OutString = Property->GetName() + TEXT(", type: ") + Property->Struct->GetName();
 		}
+		else if (InProp.Property->IsA<FArrayProperty>())
+		{
+			FScriptArrayHelper ArrayHelper(CastField<FArrayProperty>(InProp.Property.Get()), InProp.PropertyPtr);
+			OutString = InProp.Property->GetCPPType() + FString::Printf(TEXT(", num: %d"), ArrayHelper.Num());
+		}
+		else if (InProp.Property->IsA<FMapProperty>())
+		{
+			FScriptMapHelper MapHelper(CastField<FMapProperty>(InProp.Property.Get()), InProp.PropertyPtr);
+			OutString = InProp.Property->GetCPPType() + FString::Printf(TEXT(", num: %d"), MapHelper.Num());
+		}
+		else if (InProp.Property->IsA<FSetProperty>())
+		{
+			FScriptSetHelper SetHelper(CastField<FSetProperty>(InProp.Property.Get()), InProp.PropertyPtr);
+			OutString = InProp.Property->GetCPPType() + FString::Printf(TEXT(", num: %d"), SetHelper.Num());
+		}
 		return false;
 	}
 }
@@ -336,7 +602,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToName(const FGESWildcardProperty& In
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToName InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToName InProp is a nullptr"));
 		return false;
 	}
 
@@ -348,7 +614,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToName(const FGESWildcardProperty& In
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToName %s is not an FName."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToName %s is not an FName."), *InProp.Property->GetName());
 		return false;
 	}
 }
@@ -363,12 +629,12 @@ bool UGlobalEventSystemBPLibrary::HandlePropToStruct(const FGESWildcardProperty&
 {
 	if (InProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToStruct InProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToStruct InProp is a nullptr"));
 		return false;
 	}
 	if (OutProp.Property == nullptr)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToStruct OutProp is a nullptr"));
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToStruct OutProp is a nullptr"));
 		return false;
 	}
 
@@ -386,6 +652,50 @@ bool UGlobalEventSystemBPLibrary::HandlePropToStruct(const FGESWildcardProperty&
 	}
 }
 
+bool UGlobalEventSystemBPLibrary::Conv_PropToArray(const FGESWildcardProperty& InProp, TArray<int32>& OutArray)
+{
+	//doesn't get called due to custom thunk
+	return false;
+}
+
+bool UGlobalEventSystemBPLibrary::Conv_PropToMap(const FGESWildcardProperty& InProp, TMap<int32, int32>& OutMap)
+{
+	//doesn't get called due to custom thunk
+	return false;
+}
+
+bool UGlobalEventSystemBPLibrary::Conv_PropToSet(const FGESWildcardProperty& InProp, TSet<int32>& OutSet)
+{
+	//doesn't get called due to custom thunk
+	return false;
+}
+
+bool UGlobalEventSystemBPLibrary::HandlePropToContainer(const FGESWildcardProperty& InProp, FGESWildcardProperty& OutProp)
+{
+	if (InProp.Property == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToContainer InProp is a nullptr"));
+		return false;
+	}
+	if (OutProp.Property == nullptr)
+	{
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToContainer OutProp is a nullptr"));
+		return false;
+	}
+
+	//SameType compares container and inner (key/value/element) types
+	if (OutProp.Property->SameType(InProp.Property.Get()))
+	{
+		OutProp.Property->CopyCompleteValue(OutProp.PropertyPtr, InProp.PropertyPtr);
+		return true;
+	}
+	else
+	{
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::HandlePropToContainer %s is not a %s."), *InProp.Property->GetCPPType(), *OutProp.Property->GetCPPType());
+		return false;
+	}
+}
+
 bool UGlobalEventSystemBPLibrary::Conv_PropToObject(const FGESWildcardProperty& InProp, UObject*& OutObject)
 {
 	if (InProp.Property == nullptr)
@@ -401,7 +711,7 @@ bool UGlobalEventSystemBPLibrary::Conv_PropToObject(const FGESWildcardProperty&
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToObject %s is not an Object."), *InProp.Property->GetName());
+		UE_LOG(LogGES, Warning, TEXT("UGlobalEventSystemBPLibrary::Conv_PropToObject %s is not an Object."), *InProp.Property->GetName());
 		return false;
 	}
 }
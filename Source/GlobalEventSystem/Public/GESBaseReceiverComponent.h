@@ -21,8 +21,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
 	FGESNameBind BindSettings;
 
-	//For polling after having received an event
-	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	/** 
+	* For polling after having received an event. With bPinInternalDataForPolling blueprint reads resolve the
+	* handler's shared value at read time, from C++ use GetLastReceivedProperty.
+	*/
+	UPROPERTY(BlueprintReadOnly, BlueprintGetter = ResolveLastReceivedProperty, Category = "GES Receiver")
 	FGESWildcardProperty LastReceivedProperty;
 
 	//auto-bind as soon as this component begins play
@@ -34,8 +37,8 @@ public:
 	bool bUnbindOnEndPlay;
 
 	/**
-	* If event is the wildcard component one, this will pin data received for polling.
-	* Turned off only for optimization generally.
+	* If event is the wildcard component one, the last value received is kept for polling.
+	* The value is stored once per event by the handler and shared by all polling receivers.
 	*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
 	bool bPinInternalDataForPolling;
@@ -44,6 +47,21 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "GES Receiver")
 	bool bDidReceiveEventAtLeastOnce;
 
+	/** Fetch the last value received for polling. Returns false if nothing was received yet. */
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	bool GetLastReceivedProperty(FGESWildcardProperty& OutProperty);
+
+	/** Blueprint getter of LastReceivedProperty, the polled value isn't stored as it may move with the next emit */
+	UFUNCTION(BlueprintGetter)
+	FGESWildcardProperty ResolveLastReceivedProperty() const;
+
+	/**
+	* Start receiving into OnEvent. Called on BeginPlay if bBindOnBeginPlay and OnEvent is bound by then or on the
+	* next tick. Polling receivers skip it otherwise, call it when binding OnEvent later than that.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	void BindOnEventListener();
+
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
@@ -53,7 +71,14 @@ protected:
 	UPROPERTY()
 	FGESOnePropertySignature InternalListener;
 
-	FGESPinnedData PinnedData;
+	bool bInternalListenerBound;
+	bool bRegisteredPollReader;
+
+	//Deferred from BeginPlay for polling receivers, OnEvent may have been bound since
+	void BindIfOnEventBound();
+
+	//Owner's root component if BindSettings.bListenAtOwnerLocation
+	USceneComponent* PositionSource() const;
 
 	UFUNCTION()
 	void HandleInternalEvent(const FGESWildcardProperty& WildcardProperty);
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "GESDataTypes.generated.h"
 
+class USceneComponent;
+
 /** 
 * Global options for GESHandler. Used in BP library static calls.
 */
@@ -19,13 +21,65 @@ struct FGESGlobalOptions
 	UPROPERTY(BlueprintReadWrite, Category = "GES Global Options")
 	bool bLogStaleRemovals;
 
+	/** Call native UFUNCTION listeners through their thunk instead of ProcessEvent (ges.NativeDispatch 0 turns it off everywhere). Default true.*/
+	UPROPERTY(BlueprintReadWrite, Category = "GES Global Options")
+	bool bUseNativeDispatch;
+
 	FGESGlobalOptions()
 	{
 		bValidateStructTypes = true;
 		bLogStaleRemovals = true;
+		bUseNativeDispatch = true;
+	}
+};
+
+/** 
+* Counters of one GES bus (the default handler or a named bus), see GESGetBusStats.
+*/
+USTRUCT(BlueprintType)
+struct FGESBusStats
+{
+	GENERATED_BODY()
+
+	/** Events currently stored on this bus */
+	UPROPERTY(BlueprintReadOnly, Category = "GES Bus Stats")
+	int32 Events;
+
+	/** Listeners currently bound on this bus */
+	UPROPERTY(BlueprintReadOnly, Category = "GES Bus Stats")
+	int32 Listeners;
+
+	/** Emits since the bus was created or its stats reset */
+	UPROPERTY(BlueprintReadOnly, Category = "GES Bus Stats")
+	int64 Emits;
+
+	/** Listener calls since the bus was created or its stats reset */
+	UPROPERTY(BlueprintReadOnly, Category = "GES Bus Stats")
+	int64 Deliveries;
+
+	FGESBusStats()
+	{
+		Events = 0;
+		Listeners = 0;
+		Emits = 0;
+		Deliveries = 0;
 	}
 };
 
+/** 
+* When a listener is called. Immediate listeners run inside the emit, the others get a copy of the emit
+* delivered once the emitting world reaches that tick group (next frame if it already passed).
+*/
+UENUM(BlueprintType)
+enum class EGESDeliveryPhase : uint8
+{
+	Immediate,
+	PrePhysics,
+	PostPhysics,
+	PostUpdateWork,
+	EndOfFrame		//last tick group of the frame
+};
+
 /** Struct used to define a bind to a GES event by function name. (Used in GESBaseReceiverComponents) */
 USTRUCT(BlueprintType)
 struct FGESNameBind
@@ -44,11 +98,123 @@ struct FGESNameBind
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Local Bind")
 	FString ReceivingFunction;
 
+	/** Tick group the receiving function is called in, e.g. keep UI updates out of physics emits. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Local Bind")
+	EGESDeliveryPhase DeliveryPhase;
+
+	/** Listen at the owning actor's location, located emits (GESEmitEventAtLocation) are only received within their radius. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Local Bind")
+	bool bListenAtOwnerLocation;
+
 	FGESNameBind()
 	{
 		Domain = TEXT("global.default");
 		Event = TEXT("");
 		ReceivingFunction = TEXT("");
+		DeliveryPhase = EGESDeliveryPhase::Immediate;
+		bListenAtOwnerLocation = false;
+	}
+};
+
+/** Domain and event pair without a receiver, e.g. an input of a join */
+USTRUCT(BlueprintType)
+struct FGESDomainEvent
+{
+	GENERATED_BODY()
+
+	/** Abstract Domain name used in GES, similar to a channel concept. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	FString Domain;
+
+	/** Abstract event name used in GES. Unique when combined with Domain. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	FString Event;
+
+	FGESDomainEvent()
+	{
+		Domain = TEXT("global.default");
+		Event = TEXT("");
+	}
+};
+
+/** When a join completes */
+UENUM(BlueprintType)
+enum class EGESJoinMode : uint8
+{
+	All,		//every input has been emitted
+	Any,		//any input has been emitted
+	Sequence	//every input has been emitted in the listed order
+};
+
+/** 
+* Join of several events (GESAddJoin). Completes once, then emits OutputDomain.OutputEvent (if set) and
+* calls its native callbacks. Pinned inputs count as already emitted.
+*/
+USTRUCT(BlueprintType)
+struct FGESJoinDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	EGESJoinMode Mode;
+
+	/** Events to join, up to 64 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	TArray<FGESDomainEvent> Inputs;
+
+	/** Emitted without data when the join completes, leave Event empty for callbacks only */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	FGESDomainEvent Output;
+
+	/** Pin the output so listeners bound after completion still receive it */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Join")
+	bool bPinOutput;
+
+	FGESJoinDefinition()
+	{
+		Mode = EGESJoinMode::All;
+		bPinOutput = false;
+	}
+};
+
+/** What the delay and interval of a scheduled emit count */
+UENUM(BlueprintType)
+enum class EGESScheduleUnit : uint8
+{
+	Seconds,	//world time, stops while paused and follows time dilation
+	Frames		//world ticks
+};
+
+/**
+* When a scheduled emit (GESEmitEventDelayed) fires. Emits once after Delay, or repeats every Interval
+* after that until Count emits have been made, the emit is cancelled or its world ends.
+*/
+USTRUCT(BlueprintType)
+struct FGESEmitSchedule
+{
+	GENERATED_BODY()
+
+	/** Time until the first emit. Frames are rounded up, at least the next frame. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Schedule")
+	float Delay;
+
+	/** Time between repeats, <= 0 emits once */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Schedule")
+	float Interval;
+
+	/** Total emits of a repeating schedule, 0 repeats until cancelled */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Schedule")
+	int32 Count;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Schedule")
+	EGESScheduleUnit Unit;
+
+	FGESEmitSchedule()
+	{
+		Delay = 0.f;
+		Interval = 0.f;
+		Count = 0;
+		Unit = EGESScheduleUnit::Seconds;
 	}
 };
 
@@ -73,11 +239,21 @@ struct FGESEventContext
 	UPROPERTY()
 	UObject* WorldContext;
 
+	/** Tick group a listener bound with this context is called in, ignored by emits. */
+	UPROPERTY()
+	EGESDeliveryPhase DeliveryPhase;
+
+	/** Position of a listener bound with this context, located emits only reach it within their radius. Ignored by emits. */
+	UPROPERTY()
+	USceneComponent* PositionSource;
+
 	FGESEventContext()
 	{
 		Domain = TEXT("global.default");
 		Event = TEXT("");
 		WorldContext = nullptr;
+		DeliveryPhase = EGESDeliveryPhase::Immediate;
+		PositionSource = nullptr;
 	}
 };
 
@@ -99,6 +275,40 @@ struct FGESEmitContext : public FGESEventContext
 	}
 };
 
+/**
+* Domain.Event together with the key the event is stored under. The GES Emit Event and GES Bind Event nodes resolve
+* literal events into a handle when the blueprint compiles, emits and binds made through it don't build the key.
+*/
+USTRUCT(BlueprintType)
+struct FGESEventHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Domain;
+
+	UPROPERTY()
+	FString Event;
+
+	/** Domain.Event, same as FGESHandler::Key */
+	UPROPERTY()
+	FString Key;
+
+	FGESEventHandle()
+	{
+		Domain = TEXT("global.default");
+		Event = TEXT("");
+		Key = TEXT("global.default.");
+	}
+
+	FGESEventHandle(const FString& InDomain, const FString& InEvent)
+	{
+		Domain = InDomain;
+		Event = InEvent;
+		Key = InDomain + TEXT(".") + InEvent;
+	}
+};
+
 
 /** 
 * Wrapper struct for a wildcard property. Allows directly binding GES events to
@@ -116,6 +326,14 @@ struct FGESWildcardProperty
 	void* PropertyPtr;
 };
 
+/** Exec outputs of GESWaitForEvent */
+UENUM(BlueprintType)
+enum class EGESWaitResult : uint8
+{
+	Received,
+	TimedOut
+};
+
 /** No param Delegate */
 DECLARE_DYNAMIC_DELEGATE(FGESEmptySignature);
 
@@ -0,0 +1,115 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GESHandlerDataTypes.h"
+
+class FGESHandler;
+class FGESRecorderWriter;
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FGESDecodedPayload;
+
+/**
+* Streams every emit of a handler (key, frame, timestamp and payload serialized through its FProperty)
+* into an append-only chunked binary file. Records are appended to an in-memory chunk on the game
+* thread; full chunks are handed to a background writer thread so the game thread never waits on IO.
+*/
+class GLOBALEVENTSYSTEM_API FGESEventRecorder
+{
+public:
+	FGESEventRecorder();
+	~FGESEventRecorder();
+
+	/** Start recording Handler into FilePath (overwritten). ChunkBytes controls how often chunks are handed off. */
+	bool Start(const FString& FilePath, TSharedPtr<FGESHandler> InHandler, int32 InChunkBytes = 256 * 1024);
+
+	/** Flush the last chunk and wait for the writer to finish */
+	void Stop();
+
+	bool IsRecording() const;
+	uint64 GetRecordedCount() const;
+
+	/** Chunks discarded because the writer fell too far behind */
+	uint64 GetDroppedChunkCount() const;
+
+private:
+	void HandleEmit(const FGESPropertyEmitContext& EmitData);
+	void BeginChunk();
+	void SubmitChunk();
+
+	TWeakPtr<FGESHandler> Handler;
+	FDelegateHandle EmitHandle;
+
+	TUniquePtr<FGESRecorderWriter> Writer;
+
+	TMap<FString, uint32> KeyIds;
+	TArray<uint8> Chunk;
+	uint32 ChunkRecordCount;
+	int32 ChunkBytes;
+
+	double StartTime;
+	uint64 RecordedCount;
+};
+
+/**
+* Memory maps a recording and re-injects its events into a (typically fresh) handler,
+* either at recorded timing scaled by TimeScale or all at once for offline benchmarks.
+*/
+class GLOBALEVENTSYSTEM_API FGESEventPlayer
+{
+public:
+	FGESEventPlayer();
+	~FGESEventPlayer();
+
+	bool Open(const FString& FilePath);
+	void Close();
+
+	/** Start ticked playback. TimeScale > 1 plays faster than recorded. */
+	bool Play(TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext, float InTimeScale = 1.f);
+	void Stop();
+	bool IsPlaying() const;
+
+	/** Emit every remaining event immediately, returns number of events emitted */
+	int32 ReplayAll(TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext);
+
+	/** Restart from the beginning of the file */
+	void Rewind();
+
+	uint64 GetPlayedCount() const;
+
+private:
+	struct FPendingEmit
+	{
+		FGESEmitContext Context;
+		double Seconds;
+		uint64 Frame;
+		bool bValid;
+	};
+
+	bool Tick(float DeltaTime);
+	bool ReadNextEmit();
+	void EmitPending();
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	const uint8* Data;
+	uint64 DataNum;
+
+	//read position of the next record and bounds of the current chunk
+	uint64 Cursor;
+	uint64 ChunkEnd;
+
+	TArray<FGESEventContext> KeyTable;
+	FPendingEmit Pending;
+	TUniquePtr<FGESDecodedPayload> PendingPayload;
+
+	TWeakPtr<FGESHandler> Handler;
+	TWeakObjectPtr<UObject> WorldContext;
+	FTSTicker::FDelegateHandle TickHandle;
+	float TimeScale;
+	double PlaybackSeconds;
+	uint64 PlayedCount;
+};
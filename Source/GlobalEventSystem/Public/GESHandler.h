@@ -4,6 +4,7 @@
 #include "GESWorldListenerActor.h"
 #include "GESDataTypes.h"
 #include "GESHandlerDataTypes.h"
+#include "Containers/Ticker.h"
 
 //Text macro to handle TEXT("") emits
 #if !defined(GES_RAW_TEXT)
@@ -14,11 +15,16 @@
 	#endif
 #endif
 
+class FGESTimerWheel;
+struct FGESWorldSchedule;
+struct FGESScheduledEmit;
+struct FGESWorldPhases;
+
 /** 
 GESHandler Class usable in C++ with care. Private API may be a bit too exposed atm.
 */
 
-class GLOBALEVENTSYSTEM_API FGESHandler
+class GLOBALEVENTSYSTEM_API FGESHandler : public TSharedFromThis<FGESHandler>
 {
 public:
 
@@ -26,7 +32,51 @@ public:
 	static TSharedPtr<FGESHandler> DefaultHandler();
 
 	/**
-	*   Clear all listeners and reset state
+	*	Named bus with its own events, listeners, options and stats. Created on first use, NAME_None is the default handler.
+	*/
+	static TSharedPtr<FGESHandler> Bus(const FName& BusName);
+
+	/**
+	*	Route DomainPrefix and its sub-domains (DomainPrefix.*) to BusName, the longest matching prefix wins.
+	*	Routing an already routed prefix replaces it, NAME_None routes it back to the default handler.
+	*	Route before binding, existing listeners and pinned data stay on the bus they were added to.
+	*/
+	static void RouteDomain(const FString& DomainPrefix, const FName& BusName);
+
+	/** Handler owning Domain per the routing table, the default handler if no route matches */
+	static TSharedPtr<FGESHandler> ForDomain(const FString& Domain);
+
+	/**
+	*	ForDomain for calls made by Context. The reserved domain "actor" and its sub-domains (actor.*) go to the actor
+	*	scoped bus of Context (ForScope), everything else is routed as usual.
+	*/
+	static TSharedPtr<FGESHandler> ForDomain(const FString& Domain, UObject* Context);
+
+	/** ForDomain(Domain, Context) without creating an actor scope, nullptr if Context's actor has none. Use to unbind. */
+	static TSharedPtr<FGESHandler> FindForDomain(const FString& Domain, UObject* Context);
+
+	/**
+	*	Bus of ScopeObject's actor (the actor itself or the actor owning it) for traffic that stays within that actor,
+	*	e.g. between its components. Created on first use with a UGESScopeComponent on the actor and freed with it,
+	*	so its events never enter the global event map and keys can't collide across actors. Outside of spawned
+	*	actors this logs a warning and returns the default handler.
+	*/
+	static TSharedPtr<FGESHandler> ForScope(UObject* ScopeObject);
+
+	/** Actor scoped bus of ScopeObject if it has been created, nullptr otherwise */
+	static TSharedPtr<FGESHandler> FindScope(UObject* ScopeObject);
+
+	/**
+	*	Call Func on the default handler and every named bus, e.g. to unbind a receiver everywhere. bIncludeScoped also
+	*	visits live actor scoped buses, for lookups by handle that can't know the actor.
+	*/
+	static void ForEachHandler(TFunctionRef<void(FGESHandler&)> Func, bool bIncludeScoped = false);
+
+	/** Handler holding the pending request RequestId, the default handler if none does */
+	static TSharedPtr<FGESHandler> ForRequest(int32 RequestId);
+
+	/**
+	*   Clear all listeners and reset state of the default handler and all buses, routes are kept
 	*/
 	static void Clear();
 
@@ -50,34 +100,109 @@ public:
 	*/
 	bool HasEvent(const FString& Domain, const FString& Event);
 
+	/**
+	*	Check if Domain.Event has at least one listener bound, a single map lookup without allocating
+	*/
+	bool HasListeners(const FString& Domain, const FString& Event) const;
+
+	/**
+	*	Check if emitting EmitData would reach anything: listeners, poll readers, emit observers (OnEmit) or a pin, set
+	*	by this emit or held by the event. Emits for which this is false can skip building their payload, see EmitLazy.
+	*/
+	bool WantsEmit(const FGESEmitContext& EmitData) const;
+
+	/** 
+	*	Check if event exists and currently holds a pinned emit
+	*/
+	bool IsEventPinned(const FString& Domain, const FString& Event);
+
+	/**
+	*	Read the pinned value of Domain.Event without adding a listener, a single map lookup. Returns false if the
+	*	event isn't pinned. OutProperty points at handler owned data, valid until the event is emitted or deleted.
+	*	A pinned emit without data returns true with a null property. OutVersion changes on every pinned emit and
+	*	unpin (also when returning false), compare it with a previous read to skip unchanged values.
+	*/
+	bool TryGetPinned(const FString& Domain, const FString& Event, FGESWildcardProperty& OutProperty, uint32* OutVersion = nullptr);
+
+	/**
+	*	Copy the pinned value of Domain.Event into OutPtr described by OutProperty. Returns false if the event isn't
+	*	pinned or the pinned type can't be copied into OutProperty. Numbers convert to floating point and objects
+	*	copy into compatible object properties.
+	*/
+	bool TryGetPinned(const FString& Domain, const FString& Event, FProperty* OutProperty, void* OutPtr, uint32* OutVersion = nullptr);
+
+	//Typed pinned reads, see above
+	bool TryGetPinned(const FString& Domain, const FString& Event, bool& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, int32& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, float& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, double& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, FString& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, FName& OutValue, uint32* OutVersion = nullptr);
+	bool TryGetPinned(const FString& Domain, const FString& Event, UObject*& OutValue, uint32* OutVersion = nullptr);
+
+	/** Read a pinned struct of type Struct into OutStructPtr */
+	bool TryGetPinnedStruct(const FString& Domain, const FString& Event, UScriptStruct* Struct, void* OutStructPtr, uint32* OutVersion = nullptr);
+
+	/** Read a pinned USTRUCT, e.g. TryGetPinned(Domain, Event, MyVector) */
+	template<typename TStruct>
+	bool TryGetPinned(const FString& Domain, const FString& Event, TStruct& OutStruct, uint32* OutVersion = nullptr)
+	{
+		return TryGetPinnedStruct(Domain, Event, TBaseStructure<TStruct>::Get(), &OutStruct, OutVersion);
+	}
+
 	/** 
 	*	Removes the pinning of the event for future listeners.
 	*/
 	void UnpinEvent(const FString& Domain, const FString& Event);
 
 	/** 
-	* Listen to an event in TargetDomain.TargetFunction via generic listener
+	* Listen to an event in TargetDomain.TargetFunction via generic listener. Listeners with a DeliveryPhase after
+	* Immediate get a copy of each emit once the emitting world reaches that tick group, see EGESDeliveryPhase.
 	*/
 	void AddListener(const FString& Domain, const FString& Event, const FGESEventListener& Listener);
 
+	/** Listen to the event of a handle resolved ahead of time, skips building the event key */
+	void AddListener(const FGESEventHandle& Handle, const FGESEventListener& Listener);
+
+	/**
+	*	Add many listeners in one call, e.g. all binds of a receiver at BeginPlay
+	*/
+	void AddListeners(const TArray<FGESListenerBind>& Binds);
+
 	/**
 	*	Listen to an event in TargetDomain.TargetFunction via passed in lambda
 	*/
 	FString AddLambdaListener(FGESEventContext EventInfo, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda);
 	
+	/**
+	*	Listen to the next emit of an event only, the listener removes itself after the first delivery.
+	*	Pinned events are delivered immediately without adding a listener, the returned name is empty in that case.
+	*/
+	FString AddOneShotLambdaListener(FGESEventContext EventInfo, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda);
+
+	/**
+	*	Wait for the next emit of an event, or its pinned value. The future is set to true on delivery, or to false once
+	*	Timeout seconds have passed (<= 0 waits for the event) or the wait ends otherwise (e.g. the world context is gone).
+	*	OnEvent receives the value during delivery, the data is only valid inside the callback.
+	*/
+	TFuture<bool> WaitForEvent(FGESEventContext EventInfo, TFunction<void(const FGESWildcardProperty&)> OnEvent = nullptr, float Timeout = 0.f);
+
 	/**
 	* Stop listening to an event in TargetDomain.TargetFunction
 	*/
 	void RemoveListener(const FString& Domain, const FString& Event, const FGESEventListener& Listener);
 
 	/**
-	* Stop listening to all events for given receiver
+	* Stop listening to all events for given receiver. Uses the receiver index, cost scales with the receiver's binds only.
+	* Returns false if the receiver had no listeners on this bus, pass bWarnIfMissing false when sweeping several buses.
 	*/
-	void RemoveAllListenersForReceiver(UObject* ReceiverWCO);
+	bool RemoveAllListenersForReceiver(UObject* ReceiverWCO, bool bWarnIfMissing = true);
 
 	/**
-	*	Listen to an event in TargetDomain.TargetFunction via passed in lambda
+	*	Lambdas can't be compared so this can't find the listener, it only logs a warning. Keep the name
+	*	returned by AddLambdaListener and use the overload below.
 	*/
+	UE_DEPRECATED(4.26, "Lambdas can't be matched by value, pass the name returned by AddLambdaListener instead.")
 	void RemoveLambdaListener(FGESEventContext EventInfo, TFunction<void(const FGESWildcardProperty&)> ReceivingLambda);
 
 	/** 
@@ -94,9 +219,117 @@ public:
 	void EmitEvent(const FGESEmitContext& EmitData, bool ParamData);
 	void EmitEvent(const FGESEmitContext& EmitData, const FName& ParamData);
 	bool EmitEvent(const FGESEmitContext& EmitData);
+
+	/** 
+	* Emit any reflected value, e.g. a TArray/TMap/TSet UPROPERTY found via FindFProperty.
+	* Listeners receive a read-only view of the memory at PropertyPtr, a copy is only made when pinned.
+	*/
+	void EmitEvent(const FGESEmitContext& EmitData, FProperty* Property, const void* PropertyPtr);
+
+	/** 
+	* Emit through a handle resolved ahead of time (FGESEventHandle), skips building the event key. No Property emits
+	* without data. Used by the typed entry points of the GES Emit Event node.
+	*/
+	bool EmitEvent(const FGESEventHandle& Handle, UObject* WorldContext, bool bPinned, FProperty* Property = nullptr, const void* PropertyPtr = nullptr);
 	//GES_RAW_TEXT supports passing in TEXT("") macros
 	void EmitEvent(const FGESEmitContext& EmitData, const GES_RAW_TEXT RawStringMessage);
 
+	/**
+	*	Emit Domain.Event once per element of Num contiguous values described by ElementProperty. The event, world and
+	*	listeners are resolved once for the whole batch, then each element is delivered in a tight loop. Batch receivers
+	*	(AddLambdaListenerBatch, functions taking an array of the element type) get the whole batch in one call first.
+	*	A batch counts as one emit for one-shot listeners, those taking single elements receive the first one only.
+	*	Pinning pins the last element. Binds and unbinds made by callbacks apply from the next emit.
+	*/
+	void EmitBatch(const FGESEmitContext& EmitData, FProperty* ElementProperty, const void* Elements, int32 Num);
+
+	/** Batch emit of a reflected TArray, array receivers get the array itself without a copy */
+	void EmitBatch(const FGESEmitContext& EmitData, FArrayProperty* ArrayProperty, const void* ArrayPtr);
+
+	/** Batch emit of Num structs of type Struct */
+	void EmitBatch(const FGESEmitContext& EmitData, UScriptStruct* Struct, const void* Structs, int32 Num);
+
+	//typed batches
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<float> Payloads);
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<int32> Payloads);
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<bool> Payloads);
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<FString> Payloads);
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<FName> Payloads);
+	void EmitBatch(const FGESEmitContext& EmitData, TConstArrayView<UObject*> Payloads);
+
+	/** Batch emit of USTRUCTs, e.g. EmitBatchStruct<FVector>(Context, Positions) */
+	template<typename TStruct>
+	void EmitBatchStruct(const FGESEmitContext& EmitData, TConstArrayView<TStruct> Payloads)
+	{
+		EmitBatch(EmitData, TBaseStructure<TStruct>::Get(), Payloads.GetData(), Payloads.Num());
+	}
+
+	/**
+	*	Emit a payload built by Producer, which is only called if WantsEmit. Returns false if the emit was skipped.
+	*	e.g. EmitLazy<FString>(Context, [&]{ return FString::Printf(TEXT("%s hit %s"), *Name, *Other); });
+	*/
+	template<typename TPayload>
+	bool EmitLazy(const FGESEmitContext& EmitData, TFunctionRef<TPayload()> Producer)
+	{
+		if (!WantsEmit(EmitData))
+		{
+			Stats.Emits++;
+			return false;
+		}
+		EmitEvent(EmitData, Producer());
+		return true;
+	}
+
+	/** EmitLazy for USTRUCT payloads, e.g. EmitLazyStruct<FVector>(Context, [this]{ return GetActorLocation(); }) */
+	template<typename TStruct>
+	bool EmitLazyStruct(const FGESEmitContext& EmitData, TFunctionRef<TStruct()> Producer)
+	{
+		if (!WantsEmit(EmitData))
+		{
+			Stats.Emits++;
+			return false;
+		}
+		TStruct Payload = Producer();
+		EmitEvent(EmitData, TBaseStructure<TStruct>::Get(), &Payload);
+		return true;
+	}
+
+	/**
+	*	Emit Domain.Event later, once or repeating per Schedule, in the world of EmitData.WorldContext. The payload is
+	*	copied now, Property must outlive the schedule (reflected or pooled properties). Scheduled emits live in per
+	*	world timer wheels, scheduling and cancelling are O(1), and are dropped when their world ends or the world
+	*	context is gone. Returns a handle for CancelScheduledEmit, -1 if not scheduled.
+	*/
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, FProperty* Property, const void* PropertyPtr);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule);
+
+	//typed scheduled emits, objects aren't kept alive by the schedule and arrive as null if collected
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, const FString& ParamData);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, UObject* ParamData);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, float ParamData);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, int32 ParamData);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, bool ParamData);
+	int32 EmitDelayed(const FGESEmitContext& EmitData, const FGESEmitSchedule& Schedule, const FName& ParamData);
+
+	/** Stop a scheduled emit. Returns false if it already finished, was cancelled or belongs to another bus. */
+	bool CancelScheduledEmit(int32 ScheduleHandle);
+
+	/**
+	*	Emit Domain.Event at Location. Listeners bound with a PositionSource (see FGESEventContext) only receive it
+	*	within Radius of Location, they are found through a grid per event that follows their sources as they move,
+	*	so the cost scales with the listeners nearby. Listeners without a position source receive it like any emit.
+	*/
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, FProperty* Property, const void* PropertyPtr);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius);
+
+	//typed located emits
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, const FString& ParamData);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, UObject* ParamData);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, float ParamData);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, int32 ParamData);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, bool ParamData);
+	void EmitAtLocation(const FGESEmitContext& EmitData, const FVector& Location, float Radius, const FName& ParamData);
+
 	//processed means the pointers have been filled
 	bool EmitPropertyEvent(const FGESPropertyEmitContext& FullEmitData);
 
@@ -112,22 +345,129 @@ public:
 	FString AddLambdaListenerInt(FGESEventContext EventInfo, TFunction<void(int32)> ReceivingLambda);
 	FString AddLambdaListenerBool(FGESEventContext EventInfo, TFunction<void(bool)> ReceivingLambda);
 
+	//container binds, helpers are read-only views into the emitter's container and only valid during the callback
+	FString AddLambdaListenerArray(FGESEventContext EventInfo, TFunction<void(const FArrayProperty*, const FScriptArrayHelper&)> ReceivingLambda);
+	FString AddLambdaListenerMap(FGESEventContext EventInfo, TFunction<void(const FMapProperty*, const FScriptMapHelper&)> ReceivingLambda);
+	FString AddLambdaListenerSet(FGESEventContext EventInfo, TFunction<void(const FSetProperty*, const FScriptSetHelper&)> ReceivingLambda);
+
+	//receives each EmitBatch in a single call, single emits arrive as batches of one
+	FString AddLambdaListenerBatch(FGESEventContext EventInfo, TFunction<void(const FGESBatchView&)> ReceivingLambda);
+
+	/**
+	*	Emit Domain.Event as a request. Listeners read GetCurrentRequestId() while it is delivered and answer with Reply(),
+	*	the reply goes straight to OnReply instead of being broadcast to every requester. If Timeout seconds pass first
+	*	OnReply is called with bReplied false and no value, Timeout <= 0 waits for a reply. Returns the request id, -1 if not sent.
+	*/
+	int32 EmitRequest(const FGESEmitContext& EmitData, FProperty* Property, const void* PropertyPtr, TFunction<void(bool bReplied, const FGESWildcardProperty& Reply)> OnReply, float Timeout = 0.f);
+
+	/** Id of the request currently being delivered, -1 outside of request emits. Store it to reply later. */
+	int32 GetCurrentRequestId() const;
+
+	/** 
+	*	Answer a pending request, the first reply completes it. Returns false if the request already completed, expired or was cancelled.
+	*	Reply data is only valid during the OnReply call.
+	*/
+	bool Reply(int32 RequestId, FProperty* Property, const void* PropertyPtr);
+	bool Reply(int32 RequestId);
+	bool Reply(int32 RequestId, const FString& ReplyData);
+	bool Reply(int32 RequestId, UObject* ReplyData);
+	bool Reply(int32 RequestId, float ReplyData);
+	bool Reply(int32 RequestId, int32 ReplyData);
+	bool Reply(int32 RequestId, bool ReplyData);
+	bool Reply(int32 RequestId, const FName& ReplyData);
+	bool Reply(int32 RequestId, const GES_RAW_TEXT ReplyData);
+
+	/** Drop a pending request without calling its OnReply */
+	void CancelRequest(int32 RequestId);
+
+	/**
+	*	Join several events, see FGESJoinDefinition. Subscribes once per input and tracks inputs in a bitmask, OnComplete
+	*	is called once the join completes (right away if it already has). Joins with the same definition in the same world
+	*	are shared. Joins and their handles end with their world. Returns a handle for RemoveJoin, -1 if the definition
+	*	is invalid.
+	*/
+	int32 AddJoin(UObject* WorldContext, const FGESJoinDefinition& Definition, TFunction<void()> OnComplete = nullptr);
+
+	/** Release a join handle, the join stops listening once its last handle is released */
+	void RemoveJoin(int32 JoinHandle);
+
 	/**
 	* Update global options
 	*/
 	void SetOptions(const FGESGlobalOptions& InOptions);
+
+	/** Name of this bus, NAME_None for the default handler, the actor's name for scoped buses */
+	FName GetBusName() const;
+
+	/** Whether this is the bus of an actor scope, see ForScope */
+	bool IsScoped() const;
+
+	/** Current event and listener counts plus traffic counters */
+	FGESBusStats GetStats() const;
+	void ResetStats();
+
+	/**
+	*	Approximate memory held by this handler broken down by events, listeners by kind, pinned and polled values,
+	*	receiver index and world bookkeeping, plus the TopDomainCount largest domains. Walks every event, meant for
+	*	reports (ges.MemReport) rather than per frame use.
+	*/
+	FGESMemoryStats GetMemoryStats(int32 TopDomainCount = 10) const;
 	
+	/**
+	* Register a polling reader for Domain.Event. While readers exist the handler keeps one copy of the
+	* last emitted value per event, readers fetch it via GetPolledValue instead of copying on every emit.
+	*/
+	void AddPollReader(const FString& Domain, const FString& Event);
+	void RemovePollReader(const FString& Domain, const FString& Event);
+
+	/** 
+	* Last value emitted to Domain.Event since readers were registered. Returns false if there is none.
+	* OutProperty points into handler owned memory, valid until the next emit of this event.
+	*/
+	bool GetPolledValue(const FString& Domain, const FString& Event, FGESWildcardProperty& OutProperty);
+
 	/** 
 	* Convenience internal Key for domain and event string
 	*/
 	static FString Key(const FString& Domain, const FString& Event);
 
+	/** EventMap lookup of Domain.Event without building a Key string, for checks that run on every emit */
+	const FGESEvent* FindEvent(const FString& Domain, const FString& Event) const;
+
+	/** 
+	* Called for every emit after pinning and before listeners are called, e.g. for bridges and recorders.
+	* Payload pointers are only valid during the broadcast.
+	*/
+	FGESEmitObserverSignature OnEmit;
+
 	FGESHandler();
 	~FGESHandler();
 
 private:
 	static TSharedPtr<FGESHandler> PrivateDefaultHandler;
 
+	//Named buses and the prefix routes to them (longest prefix first), resolved domains are cached until routes change
+	static TMap<FName, TSharedPtr<FGESHandler>> PrivateBuses;
+	static TArray<TPair<FString, FName>> PrivateRoutes;
+	static TMap<FString, TSharedPtr<FGESHandler>> PrivateRouteCache;
+
+	//Live actor scoped buses, only for lookups by handle (requests, schedules, joins). Owned by their scope component.
+	static TMap<FGESHandler*, TWeakPtr<FGESHandler>> PrivateScopedBuses;
+
+	//Resolves the event of an emit (created only when pinning) and applies world bookkeeping, pin, poll and stats.
+	//Returns nullptr if there is nothing to deliver to. Batch emits pass their elements, EmitData holds the last one.
+	FGESEvent* BeginEmit(const FGESPropertyEmitContext& EmitData, const FString& KeyString, const FGESBatchView* Batch = nullptr);
+
+	//Key of a handle emit, otherwise Key(Domain, Event) built into KeyStorage
+	static const FString& EmitKey(const FGESPropertyEmitContext& EmitData, FString& KeyStorage);
+
+	void AddListenerToKey(const FString& Domain, const FString& EventName, const FString& KeyString, const FGESEventListener& Listener);
+	void ObserveEmit(const FGESPropertyEmitContext& EmitData, const FGESBatchView* Batch);
+	void RemoveStaleListeners(const FString& KeyString, TArrayView<const FGESEventListener* const> StaleListeners);
+
+	//EmitBatch delivery, ArrayProperty/ArrayPtr are set if the batch is a reflected array
+	void EmitBatchToListeners(const FGESPropertyEmitContext& EmitData, const FGESBatchView& Batch, FArrayProperty* ArrayProperty, const void* ArrayPtr);
+
 	//internal helper for in-context data filling for listeners
 	void EmitToListenersWithData(const FGESPropertyEmitContext& EmitData, TFunction<void(const FGESEventListener&)> DataFillCallback);
 	//internal emitter to each listener
@@ -145,16 +485,96 @@ private:
 	static FString EmitEventLogString(const FGESEmitContext& EmitData);
 	static void FunctionParameters(UFunction* Function, TArray<FProperty*>& OutParamProperties);
 
-	//this function logs warnings otherwise
-	static bool FunctionHasValidParams(UFunction* Function, FFieldClass* ClassType, const FGESEmitContext& EmitData, const FGESEventListener& Listener);
+	//checks the listener's first param (cached by LinkFunction), this function logs warnings otherwise
+	static bool FunctionHasValidParams(FFieldClass* ClassType, const FGESEmitContext& EmitData, const FGESEventListener& Listener);
+
+	//objects only reach object params of a class they are, logs warnings otherwise
+	static bool FunctionAcceptsObject(UObject* Object, const FGESEmitContext& EmitData, const FGESEventListener& Listener);
+
+	//containers are passed as views so inner types have to match exactly, logs warnings otherwise
+	static bool FunctionHasMatchingContainerParam(const FGESPropertyEmitContext& EmitData, const FGESEventListener& Listener);
+	static bool IsContainerProperty(FProperty* Property);
+
+	//Calls the listener's UFunction, native targets skip ProcessEvent (see FGESEventListener::LinkFunction)
+	void CallListenerFunction(const FGESEventListener& Listener, void* Parms) const;
+
+	uint32 NextLambdaId;
+
+	//Source of FGESEvent::PinnedVersion, handler wide so a compacted and re-pinned event never repeats a version
+	uint32 NextPinnedVersion;
+
+	//Timeouts of WaitForEvent and requests share one wheel, ticked on the core ticker only while timers are pending.
+	//The wheel only exists while it has timers.
+	void AddTimeout(double Delay, TFunction<void()> OnExpire);
+	bool TickTimeouts(float DeltaTime);
+	TUniquePtr<FGESTimerWheel> TimeoutWheel;
+	FTSTicker::FDelegateHandle TimeoutTickerHandle;
+
+	//World listener of World, spawned on first use. Tracks the world's events and drives its scheduled emits.
+	AGESWorldListenerActor* WorldListenerFor(UWorld* World);
+
+	//Scheduled emits per world (see FGESWorldSchedule), their handles map back to the world
+	FGESWorldSchedule& WorldScheduleFor(UWorld* World);
+	FGESScheduledEmit* FindScheduledEmit(int32 ScheduleHandle, FGESWorldSchedule** OutSchedule = nullptr);
+	void ArmScheduledEmit(UWorld* World, FGESWorldSchedule& Schedule, int32 ScheduleHandle, FGESScheduledEmit& Scheduled, float Delay);
+	void FireScheduledEmit(UWorld* World, int32 ScheduleHandle);
+	void RemoveScheduledEmit(FGESWorldSchedule& Schedule, int32 ScheduleHandle);
+	void TickWorldSchedule(UWorld* World, float DeltaSeconds);
+	TMap<UWorld*, TUniquePtr<FGESWorldSchedule>> WorldSchedules;
+	TMap<int32, UWorld*> ScheduledEmitWorlds;
+
+	//Listeners of later delivery phases are skipped by the emit, which queues one payload copy per phase and world.
+	//Each phase is replayed to its listeners from a tick function in its tick group (see FGESWorldPhases).
+	void QueueDeferredEmit(const FGESPropertyEmitContext& EmitData, uint32 PhaseMask);
+	void DeliverDeferredEmits(UWorld* World, EGESDeliveryPhase Phase);
+	TMap<UWorld*, TUniquePtr<FGESWorldPhases>> WorldPhases;
+
+	//Events left without listeners, pin or poll readers are queued on removal and deleted from the core ticker,
+	//ges.CompactBudget per tick. Emits never create unpinned events, so one-off emits leave nothing behind.
+	static bool IsEventUnused(const FGESEvent& Event);
+	void QueueCompaction(const FString& KeyString, const FGESEvent& Event);
+	bool TickCompaction(float DeltaTime);
+	TSet<FString> CompactionQueue;
+	FTSTicker::FDelegateHandle CompactionTickerHandle;
+
+	//Pending requests, indexed by the low 16 bits of the request id
+	int32 FindRequestIndex(int32 RequestId) const;
+	bool CompleteRequest(int32 RequestId, bool bReplied, const FGESWildcardProperty& ReplyData);
+	TArray<FGESPendingRequest> RequestTable;
+	TArray<int32> FreeRequestSlots;
+
+	//Shared by all buses: request ids, join and schedule handles stay unique across them, so calls without a domain can find their bus
+	static int32 CurrentRequestId;
+	static uint16 NextRequestGeneration;
+	static int32 NextJoinId;
+	static int32 NextScheduleId;
+
+	//Joins by id, shared via their definition key. Handles map to the join they consume.
+	void OnJoinInput(int32 JoinId, int32 InputIndex);
+	void CompleteJoin(int32 JoinId);
+	void RemoveJoinListeners(const FGESJoin& Join, int32 JoinId, bool bIncludeScopedInputs = true);
+	void DropJoin(int32 JoinId);
+	void RemoveWorldJoins(UWorld* World);
+	static FName JoinListenerName(int32 JoinId, int32 InputIndex);
+	TMap<int32, FGESJoin> Joins;
+	TMap<FString, int32> JoinIdsByKey;
+	TMap<int32, int32> JoinHandles;
 
 	//Key == TargetDomain.TargetFunction
 	TMap<FString, FGESEvent> EventMap;
-	TMap<UObject*, TArray<FGESEventListenerWithContext>> ReceiverMap;
-	TArray<FGESEventListener*> RemovalArray;
+	TMap<UObject*, TArray<FGESReceiverBind>> ReceiverMap;
 
 	//Toggles
 	FGESGlobalOptions Options;
 
+	FName BusName;
+	FGESBusStats Stats;
+
+	//Actor scoped buses end with their UGESScopeComponent instead of a world, they skip world event tracking
+	friend class UGESScopeComponent;
+	bool bIsScoped;
+	static TSharedPtr<FGESHandler> MakeScoped(FName ScopeName);
+	void ReleaseWorldListeners();
+
 	TMap<UWorld*, AGESWorldListenerActor*> WorldMap;
 };
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "GESDataTypes.h"
+#include "Async/Future.h"
+#include "Misc/TVariant.h"
+
+class FGESSpatialIndex;
 
 /** Struct to hold pinned property data */
 struct FGESPinnedData
@@ -10,20 +14,72 @@ struct FGESPinnedData
 	TArray<uint8> PropertyData;
 	bool bHandlePropertyDeletion;
 
+	//True when PropertyData holds an initialized value of Property that needs destruction
+	bool bPropertyDataInitialized;
+
 	FGESPinnedData()
 	{
 		Property = nullptr;
 		PropertyPtr = nullptr;
 		bHandlePropertyDeletion = false;
+		bPropertyDataInitialized = false;
 	}
 	~FGESPinnedData()
 	{
 		CleanupPinnedData();
 	}
+
+	//Deep copies the value at PropertyPtr via its property (safe for strings, containers and structs)
 	void CopyPropertyToPinnedBuffer();
 	void CleanupPinnedData();
 };
 
+/**
+* Last emitted value of an event, kept by the handler for polling receivers so they don't each keep a copy.
+* Buffer and property are reused across emits of the same type. Temporary C++ emit properties are duplicated once.
+*/
+struct FGESPollSlot
+{
+	FProperty* Property;
+	bool bOwnsProperty;
+	TArray<uint8> Buffer;
+	bool bHasValue;
+
+	//Number of receivers polling this event, the slot is only filled while > 0
+	int32 ReaderCount;
+
+	FGESPollSlot()
+	{
+		Property = nullptr;
+		bOwnsProperty = false;
+		bHasValue = false;
+		ReaderCount = 0;
+	}
+
+	//Copies start empty, values are never shared between slots
+	FGESPollSlot(const FGESPollSlot& Other)
+	{
+		Property = nullptr;
+		bOwnsProperty = false;
+		bHasValue = false;
+		ReaderCount = Other.ReaderCount;
+	}
+	FGESPollSlot& operator=(const FGESPollSlot& Other)
+	{
+		Reset();
+		ReaderCount = Other.ReaderCount;
+		return *this;
+	}
+	~FGESPollSlot()
+	{
+		Reset();
+	}
+
+	/** Copy the value at InPropertyPtr. bIsTemporary if InProperty won't outlive the emit. */
+	void Store(FProperty* InProperty, const void* InPropertyPtr, bool bIsTemporary);
+	void Reset();
+};
+
 struct FGESDynamicArg
 {
 	void* Arg01;
@@ -33,7 +89,9 @@ struct FGESDynamicArg
 struct FGESMinimalEventListener
 {
 	TWeakObjectPtr<UObject> ReceiverWCO;	//WorldContextObject
-	FString FunctionName;
+
+	//Interned. Generated lambda names keep the counter in the FName number so unique names don't grow the name table.
+	FName FunctionName;
 
 	bool operator ==(FGESMinimalEventListener const& Other)
 	{
@@ -42,26 +100,155 @@ struct FGESMinimalEventListener
 	FGESMinimalEventListener();
 };
 
-struct FGESEventListener : FGESMinimalEventListener
+/** How a listener receives events, each listener uses exactly one kind. Order matches FGESEventListener::Target. */
+enum class EGESListenerKind : uint8
+{
+	Function,	//UFUNCTION on the receiver found by FunctionName
+	Delegate,	//wildcard dynamic delegate
+	Lambda
+};
+
+/** Function kind target, valid after FGESEventListener::LinkFunction */
+struct FGESFunctionTarget
 {
-	// Opt A) Bound UFunction, valid after calling LinkFunction
 	UFunction* Function;
 
-	// Opt B) Bound to a delegate
-	bool bIsBoundToDelegate;
-	FGESOnePropertySignature OnePropertyFunctionDelegate;
+	//Resolved once so emits don't walk the function's params per listener, nullptr if it takes none
+	FProperty* FirstParam;
+
+	FGESFunctionTarget()
+	{
+		Function = nullptr;
+		FirstParam = nullptr;
+	}
+};
+
+/** Listener options few listeners use. Allocated on first use and shared by every copy of the listener. */
+struct FGESListenerExtras
+{
+	//One-shots only. Shared so re-entrant emits iterating an older listener snapshot don't deliver twice.
+	bool bOneShotDelivered;
+
+	//Located emits only reach positioned listeners within their radius (see FGESSpatialIndex)
+	TWeakObjectPtr<USceneComponent> PositionSource;
+
+	FGESListenerExtras()
+	{
+		bOneShotDelivered = false;
+	}
+};
+
+/** 
+* Listener entry stored per event. The kind's target (function, delegate or lambda) shares one storage slot,
+* rarely used options live in Extras and flags are packed, keeping entries small with many listeners bound.
+*/
+struct FGESEventListener : FGESMinimalEventListener
+{
+	typedef TFunction<void(const FGESWildcardProperty&)> FLambda;
+
+	TVariant<FGESFunctionTarget, FGESOnePropertySignature, FLambda> Target;
+
+	//null unless the listener is a one-shot or has a position source
+	TSharedPtr<FGESListenerExtras, ESPMode::NotThreadSafe> Extras;
+
+	//Later phases get a copy of the emit from the world's phase tick, see FGESHandler::AddListener
+	EGESDeliveryPhase DeliveryPhase;
+
+	//Native single param (or no param) UFUNCTION, called through its thunk directly instead of ProcessEvent
+	uint8 bIsNativeFunction : 1;
 
-	// Opt C) Bound to a lambda function
-	bool bIsBoundToLambda;
-	TFunction<void(const FGESWildcardProperty&)> LambdaFunction;
+	//Native call passes FirstParam by reference and needs an out parm record, see GetOutParam
+	uint8 bFirstParamIsOut : 1;
+
+	//Removed after the first delivery, see MakeOneShot
+	uint8 bIsOneShot : 1;
+
+	//Lambda kind only, the lambda receives a FGESBatchView via the wrapper's PropertyPtr (see AddLambdaListenerBatch)
+	uint8 bReceivesBatch : 1;
+
+	//Set once a param mismatch has been logged so we don't spam on every emit
+	mutable uint8 bLoggedParamMismatch : 1;
 
 	FGESEventListener(const FGESMinimalEventListener& Minimal);
 	FGESEventListener();
 	bool LinkFunction();
 	bool IsValidListener() const;
+
+	EGESListenerKind Kind() const
+	{
+		return (EGESListenerKind)Target.GetIndex();
+	}
+
+	/** Bound function of a Function kind listener, nullptr for other kinds or before LinkFunction */
+	UFunction* GetFunction() const;
+	FProperty* GetFirstParam() const;
+	FProperty* GetOutParam() const;
+
+	/** Make this a Lambda kind listener */
+	void BindLambda(FLambda InLambda);
+
+	/** Make this a Delegate kind listener, the delegate is stored as is */
+	void BindDelegate(const FGESOnePropertySignature& Delegate);
+
+	/** Call a Delegate or Lambda kind listener */
+	void CallWildcard(const FGESWildcardProperty& Data) const;
+
+	/** Remove after the first delivery */
+	void MakeOneShot();
+	bool IsOneShotDelivered() const;
+	void MarkOneShotDelivered() const;
+
+	void SetPositionSource(USceneComponent* Source);
+	USceneComponent* GetPositionSource() const;
+
+	/** Bound with a position source, even if it has been destroyed since */
+	bool HasPositionSource() const;
+
+private:
+	FGESListenerExtras& MutableExtras();
 };
 
-//Wrapper struct for tracking event-receiver pairs in ReceiverMap
+/** Contiguous payloads of a batch emit (FGESHandler::EmitBatch), only valid during the callback */
+struct FGESBatchView
+{
+	FProperty* ElementProperty;
+	const uint8* Elements;
+	int32 Num;
+
+	const void* Get(int32 Index) const
+	{
+		return Elements + (SIZE_T)Index * ElementProperty->GetSize();
+	}
+
+	FGESBatchView()
+	{
+		ElementProperty = nullptr;
+		Elements = nullptr;
+		Num = 0;
+	}
+};
+
+/** A listener and the event to add it to, see FGESHandler::AddListeners */
+struct FGESListenerBind
+{
+	FString Domain;
+	FString Event;
+	FGESEventListener Listener;
+};
+
+/** ReceiverMap entry, the event and listener name of one bind of a receiver */
+struct FGESReceiverBind
+{
+	FName EventKey;	//FGESHandler::Key(Domain, Event)
+	FName FunctionName;
+
+	bool operator ==(FGESReceiverBind const& Other) const
+	{
+		return (Other.EventKey == EventKey) && (Other.FunctionName == FunctionName);
+	}
+};
+
+/** Minimal listener and its Domain.Event, enough to remove the bind later */
 struct FGESEventListenerWithContext
 {
 	FGESMinimalEventListener Listener;
@@ -83,13 +270,50 @@ struct FGESEventListenerWithContext
 	}
 };
 
+/** 
+* Copy-on-write listener array. Emits iterate a pinned snapshot, adds and removes made while a snapshot is
+* pinned (binds, unbinds and one-shot removals inside callbacks) copy the array first and leave the snapshot
+* untouched. Without re-entrant changes nothing is ever copied.
+*/
+struct FGESListenerArray
+{
+	typedef TSharedPtr<const TArray<FGESEventListener>, ESPMode::NotThreadSafe> FSnapshot;
+
+	/** Current listeners, valid until the next change */
+	const TArray<FGESEventListener>& Get() const;
+
+	/** Keep the current listeners alive and unchanged for the duration of a dispatch */
+	FSnapshot Pin() const;
+
+	void Add(const FGESEventListener& Listener);
+	int32 Remove(const FGESEventListener& Listener);
+	int32 Num() const;
+
+	FGESListenerArray();
+
+private:
+	//copies the array if a dispatch still holds it
+	TArray<FGESEventListener>& Mutable();
+
+	TSharedPtr<TArray<FGESEventListener>, ESPMode::NotThreadSafe> Array;
+};
+
 //Event specialization with pinned and listener data
 struct FGESEvent : FGESEmitContext
 {
 	//If pinned an event will emit the moment you add a listener if it has been already fired once
 	FGESPinnedData PinnedData;
 
-	TArray<FGESEventListener> Listeners;
+	FGESListenerArray Listeners;
+
+	//Filled on emit while polling receivers are registered
+	FGESPollSlot PollSlot;
+
+	//New handler wide value on every pinned emit and unpin, lets TryGetPinned callers detect changes without comparing data
+	uint32 PinnedVersion;
+
+	//Grid of the listeners with a position source, created with the first one. Also holds them in Listeners.
+	TSharedPtr<FGESSpatialIndex, ESPMode::NotThreadSafe> SpatialIndex;
 
 	FGESEvent();
 	FGESEvent(const FGESEmitContext& Other);
@@ -103,8 +327,153 @@ struct FGESPropertyEmitContext : FGESEmitContext
 	bool bHandleAllocation;
 
 	//NB: if we want a callback or pin emit
-	FGESEventListener* SpecificTarget;
+	const FGESEventListener* SpecificTarget;
+
+	//Key of a handle emit (FGESEventHandle), only valid during the emit. nullptr builds it from Domain and Event.
+	const FString* EventKey;
+
+	//Located emit (FGESHandler::EmitAtLocation), positioned listeners outside Radius of Location are skipped
+	bool bLocated;
+	FVector Location;
+	float Radius;
+
+	//DeliveryPhase (inherited) is the phase being delivered. Later phases replay a queued emit to their listeners
+	//only, without pin, poll or observers. Contexts passed in by emitters always start out Immediate.
 
 	FGESPropertyEmitContext();
 	FGESPropertyEmitContext(const FGESEmitContext& Other);
-};
\ No newline at end of file
+};
+
+/** Shared by a WaitForEvent future's one-shot listener and its timeout, whichever completes first wins */
+struct FGESWaitState
+{
+	TPromise<bool> Promise;
+	bool bCompleted;
+
+	FGESWaitState()
+	{
+		bCompleted = false;
+	}
+	~FGESWaitState()
+	{
+		//listener removed without delivery (unbind, stale receiver, handler cleared)
+		if (!bCompleted)
+		{
+			Promise.SetValue(false);
+		}
+	}
+};
+
+/** Slot in the handler's request table. Request ids carry the generation so late replies to a reused slot are rejected. */
+struct FGESPendingRequest
+{
+	TFunction<void(bool bReplied, const FGESWildcardProperty& Reply)> OnReply;
+	uint16 Generation;
+	bool bActive;
+
+	FGESPendingRequest()
+	{
+		Generation = 0;
+		bActive = false;
+	}
+};
+
+/** Shared state of a join, inputs are tracked as bits in input order */
+struct FGESJoin
+{
+	FGESJoinDefinition Definition;
+	FString Key;
+
+	//input listeners are bound to the world so the join doesn't depend on a single consumer's lifetime
+	TWeakObjectPtr<UWorld> World;
+
+	//object that added the join, resolves actor scoped inputs and output (FGESHandler::ForDomain(Domain, Context))
+	TWeakObjectPtr<UObject> Context;
+
+	uint64 ReceivedMask;
+	uint64 CompleteMask;
+
+	//set while the input listeners are added, pinned inputs arrive during that time in any order
+	bool bArming;
+	bool bCompleted;
+
+	//one entry per consumer handle, the callback may be empty
+	TMap<int32, TFunction<void()>> Callbacks;
+
+	FGESJoin()
+	{
+		ReceivedMask = 0;
+		CompleteMask = 0;
+		bArming = false;
+		bCompleted = false;
+	}
+};
+
+/** 
+* Approximate bytes held by a handler, see FGESHandler::GetMemoryStats. Counts container allocations and the
+* strings/containers owned by payloads, allocator overhead and lambda captures are not visible and not included.
+*/
+struct FGESMemoryStats
+{
+	//EventMap with its keys, domain and event strings and unused listener array slack
+	SIZE_T EventBytes;
+	int32 Events;
+
+	//Listener entries by kind
+	SIZE_T FunctionListenerBytes;
+	int32 FunctionListeners;
+	SIZE_T DelegateListenerBytes;
+	int32 DelegateListeners;
+	SIZE_T LambdaListenerBytes;
+	int32 LambdaListeners;
+
+	//Pinned values (buffers stay allocated after unpinning until the event is deleted)
+	SIZE_T PinnedBytes;
+	int32 PinnedEvents;
+
+	//Last values kept for polling receivers
+	SIZE_T PollBytes;
+
+	//ReceiverMap
+	SIZE_T ReceiverIndexBytes;
+
+	//WorldMap and the event keys each world listener tracks for cleanup
+	SIZE_T WorldBytes;
+
+	//Pending requests, joins, timeouts, scheduled emits, deferred deliveries and listener grids
+	SIZE_T OtherBytes;
+
+	//Domains with the largest footprint (events, listeners and payloads), largest first
+	TArray<TPair<FString, SIZE_T>> TopDomains;
+
+	SIZE_T ListenerBytes() const
+	{
+		return FunctionListenerBytes + DelegateListenerBytes + LambdaListenerBytes;
+	}
+
+	SIZE_T TotalBytes() const
+	{
+		return EventBytes + ListenerBytes() + PinnedBytes + PollBytes + ReceiverIndexBytes + WorldBytes + OtherBytes;
+	}
+
+	FGESMemoryStats()
+	{
+		EventBytes = 0;
+		Events = 0;
+		FunctionListenerBytes = 0;
+		FunctionListeners = 0;
+		DelegateListenerBytes = 0;
+		DelegateListeners = 0;
+		LambdaListenerBytes = 0;
+		LambdaListeners = 0;
+		PinnedBytes = 0;
+		PinnedEvents = 0;
+		PollBytes = 0;
+		ReceiverIndexBytes = 0;
+		WorldBytes = 0;
+		OtherBytes = 0;
+	}
+};
+
+/** Native observer of every broadcast emit (pinned catch-up emits to a single new listener excluded) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FGESEmitObserverSignature, const FGESPropertyEmitContext&);
\ No newline at end of file
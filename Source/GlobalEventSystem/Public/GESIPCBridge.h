@@ -0,0 +1,84 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GESHandlerDataTypes.h"
+
+class FGESHandler;
+
+/** Settings for mirroring GES events to a local external process */
+struct FGESIPCBridgeSettings
+{
+	/** POSIX shared memory name, must start with '/' */
+	FString SegmentName;
+
+	/** Bytes per direction. Rounded up to a multiple of 4. */
+	uint32 RingCapacity;
+
+	/** Domains to mirror with their sub-domains e.g. "game.score". Empty mirrors every domain. */
+	TArray<FString> MirroredDomains;
+
+	/** Whether external processes may emit events back through the inbound ring */
+	bool bAllowInjection;
+
+	FGESIPCBridgeSettings()
+	{
+		SegmentName = TEXT("/ges_bridge");
+		RingCapacity = 1 << 20;
+		bAllowInjection = true;
+	}
+};
+
+/**
+* Optional bridge mirroring selected GES domains into a lock-free shared memory ring for
+* external tools on the same machine (see Extras/GESIPCReader). The game thread only ever does
+* a non-blocking ring write per mirrored emit; a full ring drops the record and counts it.
+* Injected events are drained from the inbound ring on the core ticker and emitted on Handler.
+* Linux/Mac only, Start returns false on other platforms.
+*/
+class GLOBALEVENTSYSTEM_API FGESIPCBridge
+{
+public:
+	FGESIPCBridge();
+	~FGESIPCBridge();
+
+	/** Map the segment and start mirroring. WorldContext is used for injected emits. */
+	bool Start(const FGESIPCBridgeSettings& InSettings, TSharedPtr<FGESHandler> InHandler, UObject* InWorldContext);
+	void Stop();
+
+	bool IsRunning() const;
+
+	/** Records dropped because the outbound ring was full */
+	uint64 GetDroppedCount() const;
+
+private:
+	void HandleEmit(const FGESPropertyEmitContext& EmitData);
+	bool Tick(float DeltaTime);
+	bool ShouldMirror(const FString& Domain) const;
+	void InjectMessage(const uint8* Data, uint32 Num);
+
+	bool MapSegment();
+	void UnmapSegment();
+
+	FGESIPCBridgeSettings Settings;
+	TWeakPtr<FGESHandler> Handler;
+	TWeakObjectPtr<UObject> WorldContext;
+
+	FDelegateHandle EmitHandle;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	void* SegmentBase;
+	uint64 MappedSize;
+	int32 SegmentFd;
+
+	//this bridge created the segment, it is unlinked on Stop. Segments created by a tool are left to it.
+	bool bCreatedSegment;
+
+	//re-used per emit to avoid allocations
+	TArray<uint8> ScratchBuffer;
+
+	//don't mirror what we just injected
+	bool bIsInjecting;
+};
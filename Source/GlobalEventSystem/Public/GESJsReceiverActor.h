@@ -0,0 +1,102 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GESDataTypes.h"
+#include "GESJsReceiverActor.generated.h"
+
+/** One received event as delivered to script. Strings carry the value or a text export of it, objects are passed through. */
+USTRUCT(BlueprintType)
+struct FGESJsEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Js")
+	int32 BindId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Js")
+	FString StringValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Js")
+	UObject* ObjectValue;
+
+	FGESJsEvent()
+	{
+		BindId = -1;
+		StringValue = TEXT("");
+		ObjectValue = nullptr;
+	}
+};
+
+/**
+* Native receiver for script wrappers (e.g. Content/Scripts/ges/gesWrapper.js).
+* Each JsBind registers a GES lambda listener tagged with a bind id and all events are routed
+* through OnJsDispatch, so there is no limit on the number of binds. With bBatchEvents every event
+* received during a frame is delivered in a single OnJsDispatchBatch call on the next tick instead.
+*/
+UCLASS(BlueprintType, Blueprintable)
+class GLOBALEVENTSYSTEM_API AGESJsReceiverActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGESJsReceiverActor();
+
+	/** Deliver events once per frame through OnJsDispatchBatch instead of one call per event */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Js")
+	bool bBatchEvents;
+
+	/** Bind Domain.Event, returns the bind id passed to dispatch calls and used to unbind */
+	UFUNCTION(BlueprintCallable, Category = "GES Js")
+	int32 JsBind(const FString& Domain, const FString& Event);
+
+	/** Safe to call from inside a dispatch. Returns false if the id isn't bound. */
+	UFUNCTION(BlueprintCallable, Category = "GES Js")
+	bool JsUnbind(int32 BindId);
+
+	UFUNCTION(BlueprintCallable, Category = "GES Js")
+	void JsUnbindAll();
+
+	UFUNCTION(BlueprintCallable, Category = "GES Js")
+	void JsEmitString(const FString& Domain, const FString& Event, const FString& Value, bool bPinned = false);
+
+	UFUNCTION(BlueprintCallable, Category = "GES Js")
+	void JsEmitObject(const FString& Domain, const FString& Event, UObject* Value, bool bPinned = false);
+
+	/** Implemented by the script subclass, called for each event when not batching */
+	UFUNCTION(BlueprintImplementableEvent, Category = "GES Js")
+	void OnJsDispatch(int32 BindId, const FString& StringValue, UObject* ObjectValue);
+
+	/** Implemented by the script subclass, called once per frame with all events received since the last call */
+	UFUNCTION(BlueprintImplementableEvent, Category = "GES Js")
+	void OnJsDispatchBatch(const TArray<FGESJsEvent>& Events);
+
+	virtual void Tick(float DeltaSeconds) override;
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void HandleEvent(int32 BindId, const FGESWildcardProperty& WildcardProperty);
+	void RemovePendingUnbinds();
+
+	struct FJsBinding
+	{
+		FGESEventContext Context;
+		FString LambdaName;
+	};
+
+	TMap<int32, FJsBinding> Bindings;
+	int32 NextBindId;
+
+	//Listener removal is deferred to tick, unbinding inside a handler emit would modify the listener array being iterated
+	TArray<FJsBinding> PendingUnbinds;
+
+	UPROPERTY()
+	TArray<FGESJsEvent> PendingBatch;
+
+	//Swapped with PendingBatch on delivery so both keep their allocation
+	UPROPERTY()
+	TArray<FGESJsEvent> DeliveringBatch;
+};
@@ -0,0 +1,53 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "GESDataTypes.h"
+#include "GESHandlerDataTypes.h"
+#include "GESMultiReceiverComponent.generated.h"
+
+/** Wildcard receiver for multi binds, BindIndex is the index into Binds */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGESMultiPropertyMCSignature, int32, BindIndex, const FGESWildcardProperty&, WildcardProperty);
+
+/**
+* Receives any number of GES events with one component. Each bind either calls its ReceivingFunction
+* on the owning actor (first parameter must match the emitted type) or, with an empty ReceivingFunction,
+* broadcasts OnEvent with the bind index. All binds are added in one batch and removed in one teardown.
+*/
+UCLASS(BlueprintType, Blueprintable, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESMultiReceiverComponent : public UActorComponent
+{
+	GENERATED_UCLASS_BODY()
+public:
+	//Wildcard receiver for binds without a ReceivingFunction
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESMultiPropertyMCSignature OnEvent;
+
+	//Domain, Event, and receiving function name on the owner per bind
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	TArray<FGESNameBind> Binds;
+
+	//auto-bind as soon as this component begins play
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	bool bBindOnBeginPlay;
+
+	//Unbind the events automatically whenever gameplay ends for this component (e.g. destroyed)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	bool bUnbindOnEndPlay;
+
+	/** Bind all entries in Binds, re-binds if already bound */
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	void BindAll();
+
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	void UnbindAll();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+	//Function binds are listeners of the owner, removed one by one on UnbindAll
+	TArray<FGESEventListenerWithContext> FunctionBinds;
+	bool bIsBound;
+};
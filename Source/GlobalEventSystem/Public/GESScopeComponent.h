@@ -0,0 +1,30 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "GESHandler.h"
+#include "GESScopeComponent.generated.h"
+
+/**
+* Holds the actor scoped GES bus of its owner (FGESHandler::ForScope, "actor" domains in blueprint). Added to the
+* actor on first use, no need to place it yourself. The bus with all its events, listeners and pinned data is
+* freed when this component is destroyed.
+*/
+UCLASS(ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESScopeComponent : public UActorComponent
+{
+	GENERATED_UCLASS_BODY()
+public:
+
+	/** This actor's bus, created on first use */
+	TSharedPtr<FGESHandler> GetBus();
+
+	/** This actor's bus if it has been created, nullptr otherwise */
+	TSharedPtr<FGESHandler> FindBus() const;
+
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+private:
+	TSharedPtr<FGESHandler> Bus;
+};
@@ -0,0 +1,210 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "GESDataTypes.h"
+#include "GESTypedReceiverComponents.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESBoolReceivedSignature, bool, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESFloatReceivedSignature, float, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESIntReceivedSignature, int32, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESObjectReceivedSignature, UObject*, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESRotatorReceivedSignature, const FRotator&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESStringReceivedSignature, const FString&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESTransformReceivedSignature, const FTransform&, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGESVectorReceivedSignature, const FVector&, Value);
+
+/**
+* Base class for native typed receivers. Binds Domain.Event through the typed C++ lambda listener path,
+* so values arrive already converted without a wildcard delegate or blueprint conversion in between.
+*/
+UCLASS(Abstract, BlueprintType, ClassGroup = "Utility")
+class GLOBALEVENTSYSTEM_API UGESTypedReceiverComponent : public UActorComponent
+{
+	GENERATED_BODY()
+public:
+	UGESTypedReceiverComponent();
+
+	/** Abstract Domain name used in GES, similar to a channel concept. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	FString Domain;
+
+	/** Abstract event name used in GES. Unique when combined with Domain. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	FString Event;
+
+	/** Tick group OnReceived is called in, Immediate calls it inside the emit. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	EGESDeliveryPhase DeliveryPhase;
+
+	/** Listen at the owning actor's location, located emits (GESEmitEventAtLocation) are only received within their radius. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	bool bListenAtOwnerLocation;
+
+	//auto-bind as soon as this component begins play
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	bool bBindOnBeginPlay;
+
+	//Unbind the event automatically whenever gameplay ends for this component (e.g. destroyed)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GES Receiver")
+	bool bUnbindOnEndPlay;
+
+	/** Used to know if LastValue holds a received value */
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	bool bDidReceiveEventAtLeastOnce;
+
+	/** Bind to current Domain.Event, re-binds if already bound */
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	void Bind();
+
+	UFUNCTION(BlueprintCallable, Category = "GES Receiver")
+	void Unbind();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+	/** Add the typed lambda listener for Context, returns the lambda name for removal */
+	virtual FString AddTypedListener(const FGESEventContext& Context) PURE_VIRTUAL(UGESTypedReceiverComponent::AddTypedListener, return FString(););
+
+	FGESEventContext BoundContext;
+	FString BoundLambdaName;
+	bool bIsBound;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESBoolReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESBoolReceivedSignature OnBoolReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	bool LastValue;
+
+	UGESBoolReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESFloatReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESFloatReceivedSignature OnFloatReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	float LastValue;
+
+	UGESFloatReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESIntReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESIntReceivedSignature OnIntReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	int32 LastValue;
+
+	UGESIntReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESObjectReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESObjectReceivedSignature OnObjectReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	UObject* LastValue;
+
+	UGESObjectReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESRotatorReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESRotatorReceivedSignature OnRotatorReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	FRotator LastValue;
+
+	UGESRotatorReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESStringReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESStringReceivedSignature OnStringReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	FString LastValue;
+
+	UGESStringReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESTransformReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESTransformReceivedSignature OnTransformReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	FTransform LastValue;
+
+	UGESTransformReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
+
+UCLASS(BlueprintType, ClassGroup = "Utility", meta = (BlueprintSpawnableComponent))
+class GLOBALEVENTSYSTEM_API UGESVectorReceiverComponent : public UGESTypedReceiverComponent
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(BlueprintAssignable, Category = "GES Receiver")
+	FGESVectorReceivedSignature OnVectorReceived;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GES Receiver")
+	FVector LastValue;
+
+	UGESVectorReceiverComponent();
+
+protected:
+	virtual FString AddTypedListener(const FGESEventContext& Context) override;
+};
@@ -8,7 +8,8 @@
 
 /** 
 * An actor spawned per world by FGESHandler in order to track when the world
-* gets torn down and we have to remove all listeners for that world.
+* gets torn down and we have to remove all listeners for that world. Also drives
+* the world's scheduled emits, ticking only while some are pending.
 */
 UCLASS()
 class GLOBALEVENTSYSTEM_API AGESWorldListenerActor : public AActor
@@ -24,6 +25,11 @@ public:
 
 	TSet<FString> WorldEvents;
 
+	// Called every tick while ticking is enabled, see FGESHandler::EmitDelayed
+	TFunction<void(float)> OnTick;
+
+	virtual void Tick(float DeltaSeconds) override;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
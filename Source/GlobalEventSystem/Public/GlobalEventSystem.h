@@ -3,6 +3,39 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/** 
+* Compile-time verbosity cap for LogGES. Anything above this level is compiled out.
+* Define in your target/build.cs to override.
+*/
+#ifndef GES_LOG_COMPILETIME_VERBOSITY
+	#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+		#define GES_LOG_COMPILETIME_VERBOSITY Warning
+	#else
+		#define GES_LOG_COMPILETIME_VERBOSITY All
+	#endif
+#endif
+
+/**
+* Logging on the emit/dispatch path (param mismatches, missing functions, etc).
+* Off by default in Test/Shipping so no log strings get formatted per emit. Set to 0/1 to override.
+*/
+#ifndef GES_EMIT_LOGGING
+	#define GES_EMIT_LOGGING !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+GLOBALEVENTSYSTEM_API DECLARE_LOG_CATEGORY_EXTERN(LogGES, Log, GES_LOG_COMPILETIME_VERBOSITY);
+
+//Use for any log on the emit path, compiles to nothing when GES_EMIT_LOGGING is off
+#if GES_EMIT_LOGGING
+	#define GES_EMIT_LOG(Verbosity, Format, ...) UE_LOG(LogGES, Verbosity, Format, ##__VA_ARGS__)
+#else
+	#define GES_EMIT_LOG(Verbosity, Format, ...)
+#endif
+
+//Handler allocations (events, listeners, pinned and polled values, bookkeeping) are tracked under this LLM tag
+LLM_DECLARE_TAG_API(GES, GLOBALEVENTSYSTEM_API);
 
 class FGlobalEventSystemModule : public IModuleInterface
 {
@@ -5,6 +5,7 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GESHandler.h"
 #include "GameplayTagContainer.h"
+#include "Engine/LatentActionManager.h"
 #include "GlobalEventSystemBPLibrary.generated.h"
 
 /* 
@@ -43,36 +44,79 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 
 	/**
 	* Bind a function (to current caller) to GES event. Make sure to match your receiving function parameters to the GESEvent ones.
+	* DeliveryPhase picks the tick group the function is called in, Immediate calls it inside the emit.
+	* With a PositionSource, emits made at a location (GESEmitEventAtLocation) are only received within their radius of it.
 	*/
-	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
-	static void GESBindEvent(UObject* WorldContextObject, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""), const FString& ReceivingFunction = TEXT(""));
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject", AdvancedDisplay = "DeliveryPhase,PositionSource"), Category = "GlobalEventSystem")
+	static void GESBindEvent(UObject* WorldContextObject, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""), const FString& ReceivingFunction = TEXT(""), EGESDeliveryPhase DeliveryPhase = EGESDeliveryPhase::Immediate, USceneComponent* PositionSource = nullptr);
 
 	/**
 	* Bind a function (to current caller) to GES event defined by a GamePlayTag
 	*/
-	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
-	static void GESBindTagEvent(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FString& ReceivingFunction = TEXT(""));
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject", AdvancedDisplay = "DeliveryPhase,PositionSource"), Category = "GlobalEventSystem")
+	static void GESBindTagEvent(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FString& ReceivingFunction = TEXT(""), EGESDeliveryPhase DeliveryPhase = EGESDeliveryPhase::Immediate, USceneComponent* PositionSource = nullptr);
 
 	/**
 	* Bind a function (to current caller) to GES event defined by a GamePlayTag
 	*/
-	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
-	static void GESBindTagEventToDelegate(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FGESOnePropertySignature& ReceivingFunction);
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject", AdvancedDisplay = "DeliveryPhase,PositionSource"), Category = "GlobalEventSystem")
+	static void GESBindTagEventToDelegate(UObject* WorldContextObject, FGameplayTag DomainedEventTag, const FGESOnePropertySignature& ReceivingFunction, EGESDeliveryPhase DeliveryPhase = EGESDeliveryPhase::Immediate, USceneComponent* PositionSource = nullptr);
 
 	/**
 	* Bind an event delegate to GES event. Use blueprint utility to decode UProperty.
 	*/
-	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
-	static void GESBindEventToDelegate(UObject* WorldContextObject, const FGESOnePropertySignature& ReceivingFunction, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges create listen", WorldContext = "WorldContextObject", AdvancedDisplay = "DeliveryPhase,PositionSource"), Category = "GlobalEventSystem")
+	static void GESBindEventToDelegate(UObject* WorldContextObject, const FGESOnePropertySignature& ReceivingFunction, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""), EGESDeliveryPhase DeliveryPhase = EGESDeliveryPhase::Immediate, USceneComponent* PositionSource = nullptr);
 
 	/** 
-	* Emit desired event with data. Data can be any single property (wrap arrays/maps etc in a struct or object)
+	* Emit desired event with data. Data can be any single property including arrays, maps and sets.
 	* Pinning an event means it will emit to future listeners even if the event has already been
 	* emitted.
 	*/
 	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", WorldContext = "WorldContextObject"))
 	static void GESEmitEventOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
 
+	/**
+	* Emit the event once per element of Payloads, the event and its listeners are looked up once for the whole array.
+	* Receiving functions that take an array of the element type get the whole array in a single call instead.
+	* Pinning pins the last element.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (ArrayParm = "Payloads", Keywords = "ges emit many array batch", WorldContext = "WorldContextObject"))
+	static void GESEmitEventBatch(UObject* WorldContextObject, const TArray<int32>& Payloads, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+
+	/**
+	* Emit the event with data later, after Schedule.Delay seconds of world time or frames, optionally repeating every
+	* Schedule.Interval. Data is copied when scheduling. Pending emits end with their world. Returns a handle for
+	* GESCancelScheduledEmit, -1 if not scheduled.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", Keywords = "ges emit later timer delay repeat", WorldContext = "WorldContextObject"))
+	static int32 GESEmitEventDelayedOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, const FGESEmitSchedule& Schedule, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+
+	/**
+	* Emit the event without data later, see GESEmitEventDelayedOneParam.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges emit later timer delay repeat", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static int32 GESEmitEventDelayed(UObject* WorldContextObject, const FGESEmitSchedule& Schedule, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+
+	/**
+	* Emit the event with data at Location. Listeners bound with a position source only receive it within Radius,
+	* listeners without one receive it like any other emit.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", Keywords = "ges emit near radius area spatial", WorldContext = "WorldContextObject"))
+	static void GESEmitEventAtLocationOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, FVector Location, float Radius = 1000.f, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+
+	/**
+	* Emit the event without data at Location, see GESEmitEventAtLocationOneParam.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges emit near radius area spatial", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventAtLocation(UObject* WorldContextObject, FVector Location, float Radius = 1000.f, bool bPinned = false, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""));
+
+	/**
+	* Stop a scheduled emit. Returns false if it already finished or was cancelled.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges emit timer stop clear"), Category = "GlobalEventSystem")
+	static bool GESCancelScheduledEmit(int32 ScheduleHandle);
+
 	/** 
 	* Just emits the event with no additional data
 	* Pinning an event means it will emit to future listeners even if the event has already been
@@ -91,13 +135,95 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 
 	/**
 	* Emit desired event with data using GameplayTags to define domain and event. Data can be any single
-	* property (wrap arrays/maps etc in a struct or object).
+	* property including arrays, maps and sets.
 	* Pinning an event means it will emit to future listeners even if the event has already been
 	* emitted.
 	*/
 	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", WorldContext = "WorldContextObject"))
 	static void GESEmitTagEventOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, FGameplayTag DomainedEventTag, bool bPinned = false);
 
+	/**
+	* Emit Domain.Event as a request, listeners answer with GESReplyOneParam using the id from GESGetRequestId.
+	* Only this caller's OnReply receives the reply. If Timeout seconds pass first OnReply is called with an empty
+	* wildcard property (conversions fail), Timeout <= 0 waits for a reply. Returns the request id, -1 if not sent.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", Keywords = "ges query ask", WorldContext = "WorldContextObject"))
+	static int32 GESEmitRequestOneParam(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, const FGESOnePropertySignature& OnReply, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""), float Timeout = 0.f);
+
+	/**
+	* Answer a request with data. Returns false if the request was already answered or has expired.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "GlobalEventSystem", meta = (CustomStructureParam = "ParameterData", Keywords = "ges answer respond"))
+	static bool GESReplyOneParam(int32 RequestId, TFieldPath<FProperty> ParameterData);
+
+	/**
+	* Id of the request being received, valid inside a receiving function of a request emit. -1 otherwise.
+	*/
+	UFUNCTION(BlueprintPure, Category = "GlobalEventSystem")
+	static int32 GESGetRequestId();
+
+	//Handle emit and bind entry points of the GES Emit Event and GES Bind Event nodes. Their events are resolved into a
+	//handle when the blueprint compiles and typed emits are picked once the Data pin type is known, skipping the
+	//wildcard stack walk of GESEmitEventOneParam.
+	UFUNCTION(BlueprintPure, meta = (BlueprintInternalUseOnly = "true"), Category = "GlobalEventSystem")
+	static FGESEventHandle GESMakeEventHandle(const FString& Domain, const FString& Event);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESBindEventHandle(UObject* WorldContextObject, const FGESEventHandle& Handle, const FString& ReceivingFunction, EGESDeliveryPhase DeliveryPhase, USceneComponent* PositionSource);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventNoData(UObject* WorldContextObject, bool bPinned, const FGESEventHandle& Handle);
+
+	//structs and containers
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (BlueprintInternalUseOnly = "true", CustomStructureParam = "ParameterData", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventWildcard(UObject* WorldContextObject, TFieldPath<FProperty> ParameterData, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventBool(UObject* WorldContextObject, bool Value, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventInt(UObject* WorldContextObject, int32 Value, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventDouble(UObject* WorldContextObject, double Value, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventString(UObject* WorldContextObject, const FString& Value, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventName(UObject* WorldContextObject, FName Value, bool bPinned, const FGESEventHandle& Handle);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESEmitEventObject(UObject* WorldContextObject, UObject* Value, bool bPinned, const FGESEventHandle& Handle);
+
+	/**
+	* Wait until Domain.Event is emitted, continues right away if the event is pinned. Continues via Timed Out
+	* after Timeout seconds, Timeout <= 0 waits until the event fires. Uses a one-shot listener, nothing is polled.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Latent, LatentInfo = "LatentInfo", ExpandEnumAsExecs = "Result", Keywords = "ges wait await once", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static void GESWaitForEvent(UObject* WorldContextObject, FLatentActionInfo LatentInfo, EGESWaitResult& Result, const FString& Domain = TEXT("global.default"), const FString& Event = TEXT(""), float Timeout = 0.f);
+
+	/**
+	* Join several events (all, any or in sequence). Once complete the join emits Definition.Output, bind to that
+	* event to react. Pinned inputs count as already emitted, identical joins are shared. Returns a handle for GESRemoveJoin.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges join all any sequence combine wait", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static int32 GESAddJoin(UObject* WorldContextObject, const FGESJoinDefinition& Definition);
+
+	/**
+	* Release a join handle from GESAddJoin.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges join remove"), Category = "GlobalEventSystem")
+	static void GESRemoveJoin(int32 JoinHandle);
+
+	/**
+	* Read the pinned value of Domain.Event without binding, returns false if the event isn't pinned or the value
+	* doesn't fit Value's type. Version changes whenever the pinned value does, compare it with the last read to skip
+	* unchanged values. NB: Value appears gray until linked with a local/member variable via e.g. a Set call.
+	*/
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CustomStructureParam = "Value", Keywords = "ges pinned get read query", WorldContext = "WorldContextObject"), Category = "GlobalEventSystem")
+	static bool GESGetPinnedValue(UObject* WorldContextObject, const FString& Domain, const FString& Event, TFieldPath<FProperty>& Value, int32& Version);
+
 	/** 
 	* If an event was pinned, this will unpin it. If you wish to re-pin a different event you need to unpin the old event first.
 	*/
@@ -110,6 +236,25 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 	UFUNCTION(BlueprintCallable, Category = "GlobalEventSystemOptions")
 	static void SetGESOptions(const FGESGlobalOptions& InOptions);
 
+	/**
+	* Send DomainPrefix and its sub-domains (DomainPrefix.*) to their own bus with separate storage, options and stats.
+	* All GES calls on those domains go to that bus. Route before binding, None routes back to the default bus.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "ges bus route shard"), Category = "GlobalEventSystemOptions")
+	static void GESRouteDomainToBus(const FString& DomainPrefix, FName BusName);
+
+	/**
+	* Options of a single bus, None is the default bus (same as SetGESOptions)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GlobalEventSystemOptions")
+	static void SetGESBusOptions(FName BusName, const FGESGlobalOptions& InOptions);
+
+	/**
+	* Event, listener and traffic counters of a bus, None is the default bus
+	*/
+	UFUNCTION(BlueprintPure, meta = (Keywords = "ges bus stats profile"), Category = "GlobalEventSystemOptions")
+	static FGESBusStats GESGetBusStats(FName BusName);
+
 	//Wildcard conversions, used in wildcard event delegates from GESBindEventToWildcardDelegate
 
 	/** Convert wildcard property into a literal int */
@@ -140,6 +285,18 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 	UFUNCTION(BlueprintPure, CustomThunk, meta = (DisplayName = "To Struct (Wildcard Property)", CustomStructureParam = "OutStruct", BlueprintAutocast), Category = "Utilities|GES")
 	static bool Conv_PropToStruct(const FGESWildcardProperty& InProp, TFieldPath<FProperty>& OutStruct);
 
+	/** Convert wildcard property into an array, element type must match the emitted array */
+	UFUNCTION(BlueprintPure, CustomThunk, meta = (DisplayName = "To Array (Wildcard Property)", ArrayParm = "OutArray"), Category = "Utilities|GES")
+	static bool Conv_PropToArray(const FGESWildcardProperty& InProp, TArray<int32>& OutArray);
+
+	/** Convert wildcard property into a map, key and value types must match the emitted map */
+	UFUNCTION(BlueprintPure, CustomThunk, meta = (DisplayName = "To Map (Wildcard Property)", MapParam = "OutMap"), Category = "Utilities|GES")
+	static bool Conv_PropToMap(const FGESWildcardProperty& InProp, TMap<int32, int32>& OutMap);
+
+	/** Convert wildcard property into a set, element type must match the emitted set */
+	UFUNCTION(BlueprintPure, CustomThunk, meta = (DisplayName = "To Set (Wildcard Property)", SetParam = "OutSet"), Category = "Utilities|GES")
+	static bool Conv_PropToSet(const FGESWildcardProperty& InProp, TSet<int32>& OutSet);
+
 	/** Convert wildcard property into any Object */
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "To Object (Wildcard Property)", BlueprintAutocast), Category = "Utilities|GES")
 	static bool Conv_PropToObject(const FGESWildcardProperty& InProp, UObject*& OutObject);
@@ -174,6 +331,101 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 		P_NATIVE_END;
 	}
 
+	DECLARE_FUNCTION(execGESEmitEventWildcard)
+	{
+		Stack.MostRecentProperty = nullptr;
+		UObject* WorldContextObject = nullptr;
+
+		Stack.StepCompiledIn<FObjectProperty>(&WorldContextObject);
+
+		//Determine wildcard property
+		Stack.Step(Stack.Object, NULL);
+		FProperty* ParameterProp = CastField<FProperty>(Stack.MostRecentProperty);
+		void* PropPtr = Stack.MostRecentPropertyAddress;
+
+		P_GET_UBOOL(bPinned);
+		P_GET_STRUCT_REF(FGESEventHandle, Handle);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		HandleTypedEmit(WorldContextObject, ParameterProp, PropPtr, bPinned, Handle);
+		P_NATIVE_END;
+	}
+
+	DECLARE_FUNCTION(execGESEmitEventBatch)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESEmitContext EmitData;
+
+		Stack.StepCompiledIn<FObjectProperty>(&EmitData.WorldContext);
+
+		//Determine wildcard array property
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		void* ArrayPtr = Stack.MostRecentPropertyAddress;
+
+		Stack.StepCompiledIn<FBoolProperty>(&EmitData.bPinned);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Domain);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Event);
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		HandleEmitBatch(EmitData, ArrayProperty, ArrayPtr);
+		P_NATIVE_END;
+	}
+
+	DECLARE_FUNCTION(execGESEmitEventDelayedOneParam)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESPropertyEmitContext EmitData;
+		FGESEmitSchedule Schedule;
+
+		Stack.StepCompiledIn<FObjectProperty>(&EmitData.WorldContext);
+
+		//Determine wildcard property
+		Stack.Step(Stack.Object, NULL);
+		EmitData.Property = CastField<FProperty>(Stack.MostRecentProperty);
+		EmitData.PropertyPtr = Stack.MostRecentPropertyAddress;
+
+		Stack.StepCompiledIn<FStructProperty>(&Schedule);
+		Stack.StepCompiledIn<FBoolProperty>(&EmitData.bPinned);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Domain);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Event);
+		int32 ScheduleHandle = -1;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		ScheduleHandle = HandleEmitDelayed(EmitData, Schedule);
+		P_NATIVE_END;
+
+		*(int32*)RESULT_PARAM = ScheduleHandle;
+	}
+
+	DECLARE_FUNCTION(execGESEmitEventAtLocationOneParam)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESPropertyEmitContext EmitData;
+
+		Stack.StepCompiledIn<FObjectProperty>(&EmitData.WorldContext);
+
+		//Determine wildcard property
+		Stack.Step(Stack.Object, NULL);
+		EmitData.Property = CastField<FProperty>(Stack.MostRecentProperty);
+		EmitData.PropertyPtr = Stack.MostRecentPropertyAddress;
+
+		Stack.StepCompiledIn<FStructProperty>(&EmitData.Location);
+		Stack.StepCompiledIn<FFloatProperty>(&EmitData.Radius);
+		Stack.StepCompiledIn<FBoolProperty>(&EmitData.bPinned);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Domain);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Event);
+		EmitData.bLocated = true;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		HandleEmit(EmitData);
+		P_NATIVE_END;
+	}
+
 	DECLARE_FUNCTION(execGESEmitTagEventOneParam)
 	{
 		Stack.MostRecentProperty = nullptr;
@@ -202,6 +454,83 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 		P_NATIVE_END;
 	}
 
+	DECLARE_FUNCTION(execGESEmitRequestOneParam)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESPropertyEmitContext EmitData;
+		FGESOnePropertySignature OnReply;
+		float Timeout = 0.f;
+
+		Stack.StepCompiledIn<FObjectProperty>(&EmitData.WorldContext);
+
+		//Determine wildcard property
+		Stack.Step(Stack.Object, NULL);
+		EmitData.Property = CastField<FProperty>(Stack.MostRecentProperty);
+		EmitData.PropertyPtr = Stack.MostRecentPropertyAddress;
+
+		Stack.StepCompiledIn<FDelegateProperty>(&OnReply);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Domain);
+		Stack.StepCompiledIn<FStrProperty>(&EmitData.Event);
+		Stack.StepCompiledIn<FFloatProperty>(&Timeout);
+		int32 RequestId = -1;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		RequestId = HandleEmitRequest(EmitData, OnReply, Timeout);
+		P_NATIVE_END;
+
+		*(int32*)RESULT_PARAM = RequestId;
+	}
+
+	DECLARE_FUNCTION(execGESReplyOneParam)
+	{
+		Stack.MostRecentProperty = nullptr;
+		int32 RequestId = -1;
+
+		Stack.StepCompiledIn<FIntProperty>(&RequestId);
+
+		//Determine wildcard property
+		Stack.Step(Stack.Object, NULL);
+		FProperty* ParameterProp = CastField<FProperty>(Stack.MostRecentProperty);
+		void* PropPtr = Stack.MostRecentPropertyAddress;
+		bool bDidReply = false;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		bDidReply = FGESHandler::ForRequest(RequestId)->Reply(RequestId, ParameterProp, PropPtr);
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bDidReply;
+	}
+
+	DECLARE_FUNCTION(execGESGetPinnedValue)
+	{
+		Stack.MostRecentProperty = nullptr;
+		UObject* WorldContextObject = nullptr;
+		FString Domain;
+		FString Event;
+		FGESWildcardProperty OutProp;
+
+		Stack.StepCompiledIn<FObjectProperty>(&WorldContextObject);
+		Stack.StepCompiledIn<FStrProperty>(&Domain);
+		Stack.StepCompiledIn<FStrProperty>(&Event);
+
+		//Copy the out wildcard property address
+		Stack.Step(Stack.Object, NULL);
+		OutProp.Property = CastField<FProperty>(Stack.MostRecentProperty);
+		OutProp.PropertyPtr = Stack.MostRecentPropertyAddress;
+
+		P_GET_PROPERTY_REF(FIntProperty, Version);
+		bool bDidCopy = false;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		bDidCopy = HandleGetPinnedValue(WorldContextObject, Domain, Event, OutProp, Version);
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bDidCopy;
+	}
+
 	DECLARE_FUNCTION(execConv_PropToStruct)
 	{
 		Stack.MostRecentProperty = nullptr;
@@ -232,8 +561,79 @@ class GLOBALEVENTSYSTEM_API UGlobalEventSystemBPLibrary : public UBlueprintFunct
 		*(bool*)RESULT_PARAM = bDidCopy;
 	}
 
+	DECLARE_FUNCTION(execConv_PropToArray)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESWildcardProperty InProp;
+		FGESWildcardProperty OutProp;
+
+		Stack.StepCompiledIn<FStructProperty>(&InProp);
+
+		//Copy the out array property address
+		Stack.StepCompiledIn<FArrayProperty>(NULL);
+		OutProp.Property = CastField<FArrayProperty>(Stack.MostRecentProperty);
+		OutProp.PropertyPtr = Stack.MostRecentPropertyAddress;
+		bool bDidCopy = false;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		bDidCopy = HandlePropToContainer(InProp, OutProp);
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bDidCopy;
+	}
+
+	DECLARE_FUNCTION(execConv_PropToMap)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESWildcardProperty InProp;
+		FGESWildcardProperty OutProp;
+
+		Stack.StepCompiledIn<FStructProperty>(&InProp);
+
+		//Copy the out map property address
+		Stack.StepCompiledIn<FMapProperty>(NULL);
+		OutProp.Property = CastField<FMapProperty>(Stack.MostRecentProperty);
+		OutProp.PropertyPtr = Stack.MostRecentPropertyAddress;
+		bool bDidCopy = false;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		bDidCopy = HandlePropToContainer(InProp, OutProp);
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bDidCopy;
+	}
+
+	DECLARE_FUNCTION(execConv_PropToSet)
+	{
+		Stack.MostRecentProperty = nullptr;
+		FGESWildcardProperty InProp;
+		FGESWildcardProperty OutProp;
+
+		Stack.StepCompiledIn<FStructProperty>(&InProp);
+
+		//Copy the out set property address
+		Stack.StepCompiledIn<FSetProperty>(NULL);
+		OutProp.Property = CastField<FSetProperty>(Stack.MostRecentProperty);
+		OutProp.PropertyPtr = Stack.MostRecentPropertyAddress;
+		bool bDidCopy = false;
+
+		P_FINISH;
+		P_NATIVE_BEGIN;
+		bDidCopy = HandlePropToContainer(InProp, OutProp);
+		P_NATIVE_END;
+
+		*(bool*)RESULT_PARAM = bDidCopy;
+	}
 
 private:
 	static void HandleEmit(const FGESPropertyEmitContext& EmitData);
+	static void HandleEmitBatch(const FGESEmitContext& EmitData, FArrayProperty* ArrayProperty, void* ArrayPtr);
+	static int32 HandleEmitDelayed(const FGESPropertyEmitContext& EmitData, const FGESEmitSchedule& Schedule);
+	static int32 HandleEmitRequest(const FGESPropertyEmitContext& EmitData, const FGESOnePropertySignature& OnReply, float Timeout);
+	static void HandleTypedEmit(UObject* WorldContextObject, FProperty* Property, const void* ValuePtr, bool bPinned, const FGESEventHandle& Handle);
+	static bool HandleGetPinnedValue(UObject* WorldContextObject, const FString& Domain, const FString& Event, const FGESWildcardProperty& OutProp, int32& OutVersion);
 	static bool HandlePropToStruct(const FGESWildcardProperty& InProp, FGESWildcardProperty& FullProp);
+	static bool HandlePropToContainer(const FGESWildcardProperty& InProp, FGESWildcardProperty& OutProp);
 };
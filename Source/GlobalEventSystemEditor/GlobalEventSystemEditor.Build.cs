@@ -0,0 +1,30 @@
+// Some copyright should be here...
+
+using UnrealBuildTool;
+
+public class GlobalEventSystemEditor : ModuleRules
+{
+	public GlobalEventSystemEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"BlueprintGraph",
+			}
+			);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"KismetCompiler",
+				"UnrealEd",
+				"GlobalEventSystem",
+			}
+			);
+	}
+}
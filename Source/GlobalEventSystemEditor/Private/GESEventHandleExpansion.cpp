@@ -0,0 +1,30 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "GESEventHandleExpansion.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "KismetCompiler.h"
+#include "GlobalEventSystemBPLibrary.h"
+
+void GESEventHandleExpansion::ConnectHandle(UK2Node* Node, FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* DomainPin, UEdGraphPin* EventPin, UEdGraphPin* HandlePin)
+{
+	if (DomainPin->LinkedTo.Num() == 0 && EventPin->LinkedTo.Num() == 0)
+	{
+		//literal event, bake the key into the handle now
+		FGESEventHandle Handle(DomainPin->GetDefaultAsString(), EventPin->GetDefaultAsString());
+
+		FString HandleText;
+		FGESEventHandle::StaticStruct()->ExportText(HandleText, &Handle, nullptr, nullptr, PPF_None, nullptr);
+		CompilerContext.GetSchema()->TrySetDefaultValue(*HandlePin, HandleText);
+		return;
+	}
+
+	//event only known at runtime, make the handle once per execution
+	UK2Node_CallFunction* MakeNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(Node, SourceGraph);
+	MakeNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESMakeEventHandle), UGlobalEventSystemBPLibrary::StaticClass());
+	MakeNode->AllocateDefaultPins();
+
+	CompilerContext.MovePinLinksToIntermediate(*DomainPin, *MakeNode->FindPinChecked(TEXT("Domain")));
+	CompilerContext.MovePinLinksToIntermediate(*EventPin, *MakeNode->FindPinChecked(TEXT("Event")));
+	MakeNode->GetReturnValuePin()->MakeLinkTo(HandlePin);
+}
@@ -0,0 +1,20 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UK2Node;
+class UEdGraph;
+class UEdGraphPin;
+class FKismetCompilerContext;
+
+/** Shared expansion of the Domain and Event pins of the GES Emit Event and GES Bind Event nodes */
+namespace GESEventHandleExpansion
+{
+	/**
+	* Feed HandlePin the event handle of DomainPin and EventPin. Literal events are resolved into the pin default
+	* when the blueprint compiles, linked ones go through a GESMakeEventHandle node.
+	*/
+	void ConnectHandle(UK2Node* Node, FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* DomainPin, UEdGraphPin* EventPin, UEdGraphPin* HandlePin);
+}
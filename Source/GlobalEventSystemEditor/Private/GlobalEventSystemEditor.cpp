@@ -0,0 +1,6 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "Modules/ModuleManager.h"
+
+//Blueprint nodes only, nothing to start up
+IMPLEMENT_MODULE(FDefaultModuleImpl, GlobalEventSystemEditor)
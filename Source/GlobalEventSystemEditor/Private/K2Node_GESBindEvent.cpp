@@ -0,0 +1,125 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "K2Node_GESBindEvent.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "Components/SceneComponent.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "KismetCompiler.h"
+#include "GlobalEventSystemBPLibrary.h"
+#include "GESEventHandleExpansion.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_GESBindEvent"
+
+namespace GESBindEventPins
+{
+	static const FName Domain(TEXT("Domain"));
+	static const FName Event(TEXT("Event"));
+	static const FName ReceivingFunction(TEXT("ReceivingFunction"));
+	static const FName DeliveryPhase(TEXT("DeliveryPhase"));
+	static const FName PositionSource(TEXT("PositionSource"));
+}
+
+void UK2Node_GESBindEvent::AllocateDefaultPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+
+	UEdGraphPin* DomainPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, GESBindEventPins::Domain);
+	DomainPin->DefaultValue = TEXT("global.default");
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, GESBindEventPins::Event);
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, GESBindEventPins::ReceivingFunction);
+
+	UEnum* PhaseEnum = StaticEnum<EGESDeliveryPhase>();
+	UEdGraphPin* PhasePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, PhaseEnum, GESBindEventPins::DeliveryPhase);
+	PhasePin->DefaultValue = PhaseEnum->GetNameStringByValue((int64)EGESDeliveryPhase::Immediate);
+	PhasePin->bAdvancedView = true;
+
+	UEdGraphPin* PositionPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Object, USceneComponent::StaticClass(), GESBindEventPins::PositionSource);
+	PositionPin->bAdvancedView = true;
+
+	if (AdvancedPinDisplay == ENodeAdvancedPins::NoPins)
+	{
+		AdvancedPinDisplay = ENodeAdvancedPins::Hidden;
+	}
+
+	Super::AllocateDefaultPins();
+}
+
+FText UK2Node_GESBindEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("NodeTitle", "GES Bind Event");
+}
+
+FText UK2Node_GESBindEvent::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip", "Bind a function (to current caller) to GES event. Make sure to match your receiving function parameters to the GESEvent ones.\nDeliveryPhase picks the tick group the function is called in, Immediate calls it inside the emit.\nWith a PositionSource, emits made at a location are only received within their radius of it.");
+}
+
+FText UK2Node_GESBindEvent::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "GlobalEventSystem");
+}
+
+void UK2Node_GESBindEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+void UK2Node_GESBindEvent::ValidateNodeDuringCompilation(FCompilerResultsLog& MessageLog) const
+{
+	Super::ValidateNodeDuringCompilation(MessageLog);
+
+	//only literal function names can be checked, linked ones are looked up when binding
+	UEdGraphPin* FunctionPin = FindPinChecked(GESBindEventPins::ReceivingFunction);
+	if (FunctionPin->LinkedTo.Num() > 0 || FunctionPin->DefaultValue.IsEmpty())
+	{
+		return;
+	}
+
+	UBlueprint* Blueprint = GetBlueprint();
+	UClass* ReceiverClass = Blueprint ? Blueprint->SkeletonGeneratedClass : nullptr;
+	if (!ReceiverClass)
+	{
+		return;
+	}
+
+	UFunction* Function = ReceiverClass->FindFunctionByName(FName(*FunctionPin->DefaultValue));
+	if (!Function)
+	{
+		MessageLog.Warning(*FText::Format(LOCTEXT("MissingFunction", "@@ receiving function {0} not found in this blueprint."), FText::FromString(FunctionPin->DefaultValue)).ToString(), this);
+	}
+	else if (Function->NumParms > 1)
+	{
+		MessageLog.Warning(*FText::Format(LOCTEXT("TooManyParams", "@@ receiving function {0} takes more than one parameter, GES events carry at most one."), FText::FromString(FunctionPin->DefaultValue)).ToString(), this);
+	}
+}
+
+void UK2Node_GESBindEvent::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	UK2Node_CallFunction* CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	CallNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESBindEventHandle), UGlobalEventSystemBPLibrary::StaticClass());
+	CallNode->AllocateDefaultPins();
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *CallNode->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(UEdGraphSchema_K2::PN_Then), *CallNode->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GESBindEventPins::ReceivingFunction), *CallNode->FindPinChecked(TEXT("ReceivingFunction")));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GESBindEventPins::DeliveryPhase), *CallNode->FindPinChecked(TEXT("DeliveryPhase")));
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GESBindEventPins::PositionSource), *CallNode->FindPinChecked(TEXT("PositionSource")));
+	GESEventHandleExpansion::ConnectHandle(this, CompilerContext, SourceGraph, FindPinChecked(GESBindEventPins::Domain), FindPinChecked(GESBindEventPins::Event), CallNode->FindPinChecked(TEXT("Handle")));
+
+	BreakAllNodeLinks();
+}
+
+#undef LOCTEXT_NAMESPACE
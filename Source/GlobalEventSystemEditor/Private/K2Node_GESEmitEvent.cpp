@@ -0,0 +1,204 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#include "K2Node_GESEmitEvent.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "KismetCompiler.h"
+#include "GlobalEventSystemBPLibrary.h"
+#include "GESEventHandleExpansion.h"
+
+#define LOCTEXT_NAMESPACE "K2Node_GESEmitEvent"
+
+namespace GESEmitEventPins
+{
+	static const FName Data(TEXT("Data"));
+	static const FName Pinned(TEXT("bPinned"));
+	static const FName Domain(TEXT("Domain"));
+	static const FName Event(TEXT("Event"));
+}
+
+void UK2Node_GESEmitEvent::AllocateDefaultPins()
+{
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+	CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Wildcard, GESEmitEventPins::Data);
+
+	UEdGraphPin* PinnedPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Boolean, GESEmitEventPins::Pinned);
+	PinnedPin->DefaultValue = TEXT("false");
+
+	UEdGraphPin* DomainPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, GESEmitEventPins::Domain);
+	DomainPin->DefaultValue = TEXT("global.default");
+
+	CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, GESEmitEventPins::Event);
+
+	Super::AllocateDefaultPins();
+}
+
+FText UK2Node_GESEmitEvent::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("NodeTitle", "GES Emit Event");
+}
+
+FText UK2Node_GESEmitEvent::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip", "Emit desired event with data. Data can be any single property including arrays, maps and sets, its type is resolved when the blueprint compiles.\nPinning an event means it will emit to future listeners even if the event has already been emitted.");
+}
+
+FText UK2Node_GESEmitEvent::GetMenuCategory() const
+{
+	return LOCTEXT("MenuCategory", "GlobalEventSystem");
+}
+
+void UK2Node_GESEmitEvent::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+	UClass* ActionKey = GetClass();
+	if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+	{
+		UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+		check(NodeSpawner != nullptr);
+		ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+	}
+}
+
+UEdGraphPin* UK2Node_GESEmitEvent::GetDataPin() const
+{
+	return FindPinChecked(GESEmitEventPins::Data);
+}
+
+void UK2Node_GESEmitEvent::ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins)
+{
+	Super::ReallocatePinsDuringReconstruction(OldPins);
+
+	//keep the resolved type so links survive reconstruction
+	for (UEdGraphPin* OldPin : OldPins)
+	{
+		if (OldPin->PinName == GESEmitEventPins::Data)
+		{
+			GetDataPin()->PinType = OldPin->PinType;
+			break;
+		}
+	}
+}
+
+void UK2Node_GESEmitEvent::PostReconstructNode()
+{
+	Super::PostReconstructNode();
+	RefreshDataPinType();
+}
+
+void UK2Node_GESEmitEvent::NotifyPinConnectionListChanged(UEdGraphPin* Pin)
+{
+	Super::NotifyPinConnectionListChanged(Pin);
+
+	if (Pin && Pin->PinName == GESEmitEventPins::Data)
+	{
+		RefreshDataPinType();
+	}
+}
+
+void UK2Node_GESEmitEvent::RefreshDataPinType()
+{
+	UEdGraphPin* DataPin = GetDataPin();
+
+	FEdGraphPinType NewType;
+	if (DataPin->LinkedTo.Num() > 0)
+	{
+		NewType = DataPin->LinkedTo[0]->PinType;
+		NewType.bIsReference = false;
+		NewType.bIsConst = false;
+	}
+	else
+	{
+		NewType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+	}
+
+	if (DataPin->PinType != NewType)
+	{
+		DataPin->PinType = NewType;
+		GetGraph()->NotifyGraphChanged();
+	}
+}
+
+FName UK2Node_GESEmitEvent::EmitFunctionForType(const FEdGraphPinType& PinType)
+{
+	if (PinType.IsContainer())
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventWildcard);
+	}
+
+	const FName& Category = PinType.PinCategory;
+	if (Category == UEdGraphSchema_K2::PC_Boolean)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventBool);
+	}
+	if (Category == UEdGraphSchema_K2::PC_Int)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventInt);
+	}
+	if (Category == UEdGraphSchema_K2::PC_Real)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventDouble);
+	}
+	if (Category == UEdGraphSchema_K2::PC_String)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventString);
+	}
+	if (Category == UEdGraphSchema_K2::PC_Name)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventName);
+	}
+	if (Category == UEdGraphSchema_K2::PC_Object)
+	{
+		return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventObject);
+	}
+
+	//structs, enums, bytes, text, classes, interfaces etc. keep the wildcard path
+	return GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventWildcard);
+}
+
+void UK2Node_GESEmitEvent::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+	Super::ExpandNode(CompilerContext, SourceGraph);
+
+	UEdGraphPin* DataPin = GetDataPin();
+	const bool bHasData = DataPin->LinkedTo.Num() > 0;
+
+	if (bHasData && DataPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+	{
+		CompilerContext.MessageLog.Error(*LOCTEXT("UnresolvedData", "@@ could not resolve the type of Data.").ToString(), this);
+		BreakAllNodeLinks();
+		return;
+	}
+
+	const FName FunctionName = bHasData ?
+		EmitFunctionForType(DataPin->PinType) :
+		GET_FUNCTION_NAME_CHECKED(UGlobalEventSystemBPLibrary, GESEmitEventNoData);
+
+	UK2Node_CallFunction* CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+	CallNode->FunctionReference.SetExternalMember(FunctionName, UGlobalEventSystemBPLibrary::StaticClass());
+	CallNode->AllocateDefaultPins();
+
+	CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *CallNode->GetExecPin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(UEdGraphSchema_K2::PN_Then), *CallNode->GetThenPin());
+	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(GESEmitEventPins::Pinned), *CallNode->FindPinChecked(TEXT("bPinned")));
+	GESEventHandleExpansion::ConnectHandle(this, CompilerContext, SourceGraph, FindPinChecked(GESEmitEventPins::Domain), FindPinChecked(GESEmitEventPins::Event), CallNode->FindPinChecked(TEXT("Handle")));
+
+	if (bHasData)
+	{
+		UEdGraphPin* ValuePin = CallNode->FindPin(TEXT("Value"));
+		if (!ValuePin)
+		{
+			//wildcard fallback, give the custom structure param our resolved type
+			ValuePin = CallNode->FindPinChecked(TEXT("ParameterData"));
+			ValuePin->PinType = DataPin->PinType;
+		}
+		CompilerContext.MovePinLinksToIntermediate(*DataPin, *ValuePin);
+	}
+
+	BreakAllNodeLinks();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,30 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "K2Node.h"
+#include "K2Node_GESBindEvent.generated.h"
+
+/**
+* GES Bind Event that resolves its event when the blueprint compiles. Literal Domain and Event pins
+* become an event handle so binding doesn't build the event key, and a literal ReceivingFunction is
+* checked against the blueprint so a misspelled or mismatched function shows up as a compile warning.
+*/
+UCLASS()
+class GLOBALEVENTSYSTEMEDITOR_API UK2Node_GESBindEvent : public UK2Node
+{
+	GENERATED_BODY()
+public:
+
+	//UEdGraphNode
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+
+	//UK2Node
+	virtual bool IsNodeSafeToIgnore() const override { return true; }
+	virtual void ValidateNodeDuringCompilation(class FCompilerResultsLog& MessageLog) const override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+};
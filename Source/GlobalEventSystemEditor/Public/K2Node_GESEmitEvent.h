@@ -0,0 +1,43 @@
+// Copyright 2019-current Getnamo. All Rights Reserved
+
+#pragma once
+
+#include "K2Node.h"
+#include "K2Node_GESEmitEvent.generated.h"
+
+/**
+* GES Emit Event with a Data pin that adopts the type of whatever is connected to it. The type is
+* resolved when the blueprint compiles and the node expands to a typed emit call (bool, int, float,
+* string, name, object) so no wildcard stack walk happens per emit. Structs and containers fall back
+* to the wildcard GESEmitEventWildcard, an unconnected Data pin emits without data. Literal Domain and
+* Event pins are resolved into an event handle at compile time so emits don't build the event key.
+*/
+UCLASS()
+class GLOBALEVENTSYSTEMEDITOR_API UK2Node_GESEmitEvent : public UK2Node
+{
+	GENERATED_BODY()
+public:
+
+	//UEdGraphNode
+	virtual void AllocateDefaultPins() override;
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual void PostReconstructNode() override;
+
+	//UK2Node
+	virtual bool IsNodeSafeToIgnore() const override { return true; }
+	virtual void ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins) override;
+	virtual void NotifyPinConnectionListChanged(UEdGraphPin* Pin) override;
+	virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+	virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+	virtual FText GetMenuCategory() const override;
+
+	UEdGraphPin* GetDataPin() const;
+
+protected:
+	/** Match the Data pin to its connection, or back to wildcard when unconnected */
+	void RefreshDataPinType();
+
+	/** Native emit function in UGlobalEventSystemBPLibrary for the resolved Data pin type */
+	static FName EmitFunctionForType(const FEdGraphPinType& PinType);
+};